@@ -0,0 +1,345 @@
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW.h"
+
+#include <cstdio>
+
+// Variables ///////////////////////////////////////////////////////////////
+
+static volatile unsigned Sink;
+
+// Functions ///////////////////////////////////////////////////////////////
+
+static EDW::DisplayData CreateEdid(int extensions)
+{
+	std::basic_string<unsigned char> data(128 + extensions * 128, 0x00);
+	std::copy(std::begin(EDW::DisplayDataView::EdidHeader), std::end(EDW::DisplayDataView::EdidHeader), data.begin());
+	data[18] = 0x01;
+	data[19] = 0x04;
+	data[126] = static_cast<unsigned char>(extensions);
+
+	for (int block = 1; block <= extensions; ++block)
+	{
+		data[block * 128] = 0x02;
+		data[block * 128 + 1] = 0x03;
+		data[block * 128 + 2] = 0x04;
+
+		for (int index = 4; index < 127; ++index)
+			data[block * 128 + index] = static_cast<unsigned char>(block * 16 + index);
+	}
+
+	EDW::DisplayData displayData(data);
+	displayData.FixEdidChecksums();
+	return displayData;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static EDW::DisplayData CreateDisplayId()
+{
+	std::basic_string<unsigned char> data(256, 0x00);
+	data[0] = 0x20;
+	data[1] = 251;
+
+	for (int index = 4; index < 250; index += 3)
+		data[index] = 0x7E;
+
+	data[250] = 0x7E;
+	data[252] = 2;
+
+	EDW::DisplayData displayData(data);
+	displayData.FixDisplayIdChecksums();
+	return displayData;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+static double Measure(int iterations, T function)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (int index = 0; index < iterations; ++index)
+		function(index);
+
+	std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+	return duration.count() / iterations;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkCopy()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+
+	return Measure(2000000, [&](int index)
+	{
+		EDW::DisplayData copy = edid;
+		Sink += copy.GetSize() + index;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkMove()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+
+	return Measure(2000000, [&](int index)
+	{
+		EDW::DisplayData copy = std::move(edid);
+		edid = std::move(copy);
+		Sink += edid.GetSize() + index;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkSetByte(EDW::DisplayData edid, bool detach)
+{
+	int offset = edid.GetSize() - 64;
+
+	return Measure(200000, [&](int index)
+	{
+		EDW::DisplayData copy;
+
+		if (detach)
+			copy = edid;
+
+		EDW::DisplayData &target = detach ? copy : edid;
+		target.SetByte(offset, static_cast<unsigned char>(index));
+		Sink += target.GetSize();
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkSetByte()
+{
+	return BenchmarkSetByte(CreateEdid(1), false);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkDetach()
+{
+	return BenchmarkSetByte(CreateEdid(1), true);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkSetByteLarge()
+{
+	return BenchmarkSetByte(CreateEdid(255), false);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkDetachLarge()
+{
+	return BenchmarkSetByte(CreateEdid(255), true);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkSetByteDisplayId()
+{
+	return BenchmarkSetByte(CreateDisplayId(), false);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkSetRange()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	unsigned char data[64] = {};
+
+	return Measure(100000, [&](int index)
+	{
+		data[0] = static_cast<unsigned char>(index);
+		edid.SetRange(128 + 32, data, sizeof(data));
+		Sink += edid.GetSize();
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkWrite(bool ackPolling)
+{
+	EDW::DisplayData edids[2] = {CreateEdid(1), CreateEdid(1)};
+	EDW::Display display = EDW::Display::CreateSimulated(edids[0], EDW::DisplayData(), 5000);
+	display.SetAckPolling(ackPolling);
+
+	for (int offset = 16; offset < 128; offset += 32)
+		edids[1].SetByte(offset, 0x5A);
+
+	edids[1].FixEdidChecksums();
+
+	return Measure(20, [&](int index)
+	{
+		Sink += display.WriteEdid(edids[(index + 1) % 2]);
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkAckPolling()
+{
+	return BenchmarkWrite(true);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkFixedPacing()
+{
+	return BenchmarkWrite(false);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkSum(EDW::KernelSet kernelSet)
+{
+	if (!EDW::Kernels::SetKernelSet(kernelSet))
+		return 0.0;
+
+	EDW::DisplayData edid = CreateEdid(3);
+	const unsigned char *data = edid.GetView().GetData();
+
+	return Measure(10000000, [&](int index)
+	{
+		Sink += EDW::Kernels::Sum(data + (index & 3) * 128, 127);
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkChecksums(EDW::KernelSet kernelSet)
+{
+	if (!EDW::Kernels::SetKernelSet(kernelSet))
+		return 0.0;
+
+	EDW::DisplayData edid = CreateEdid(3);
+
+	return Measure(2000000, [&](int index)
+	{
+		Sink += edid.IsValidEdidChecksums() + index;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkScalarSum()
+{
+	return BenchmarkSum(EDW::ScalarKernels);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkSse2Sum()
+{
+	return BenchmarkSum(EDW::Sse2Kernels);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkAvx2Sum()
+{
+	return BenchmarkSum(EDW::Avx2Kernels);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkScalarChecksums()
+{
+	return BenchmarkChecksums(EDW::ScalarKernels);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkSse2Checksums()
+{
+	return BenchmarkChecksums(EDW::Sse2Kernels);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkAvx2Checksums()
+{
+	return BenchmarkChecksums(EDW::Avx2Kernels);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkHexDecode(int offsetDigits)
+{
+	EDW::DisplayData edid = CreateEdid(3);
+	std::string text;
+	EDW::Hex::Encode(text, edid.GetView().GetData(), edid.GetSize(), 16, offsetDigits, true);
+	std::vector<unsigned char> data;
+
+	return Measure(200000, [&](int index)
+	{
+		bool status = offsetDigits > 0 ? EDW::Hex::DecodeRows(data, text.data(), text.size()) : EDW::Hex::Decode(data, text.data(), text.size());
+		Sink += status + data.size() + index;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkHexDecode()
+{
+	return BenchmarkHexDecode(0);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static double BenchmarkHexDecodeRows()
+{
+	return BenchmarkHexDecode(2);
+}
+
+// Variables ///////////////////////////////////////////////////////////////
+
+static const struct
+{
+	const char *Name;
+	double (*Function)();
+}
+Benchmarks[] =
+{
+	{"Copy", BenchmarkCopy},
+	{"Move", BenchmarkMove},
+	{"SetByte", BenchmarkSetByte},
+	{"Detach", BenchmarkDetach},
+	{"SetByteLarge", BenchmarkSetByteLarge},
+	{"DetachLarge", BenchmarkDetachLarge},
+	{"SetByteDisplayId", BenchmarkSetByteDisplayId},
+	{"SetRange", BenchmarkSetRange},
+	{"AckPolling", BenchmarkAckPolling},
+	{"FixedPacing", BenchmarkFixedPacing},
+	{"ScalarSum", BenchmarkScalarSum},
+	{"Sse2Sum", BenchmarkSse2Sum},
+	{"Avx2Sum", BenchmarkAvx2Sum},
+	{"ScalarChecksums", BenchmarkScalarChecksums},
+	{"Sse2Checksums", BenchmarkSse2Checksums},
+	{"Avx2Checksums", BenchmarkAvx2Checksums},
+	{"HexDecode", BenchmarkHexDecode},
+	{"HexDecodeRows", BenchmarkHexDecodeRows}
+};
+
+// Main ////////////////////////////////////////////////////////////////////
+
+int main()
+{
+	EDW::KernelSet kernelSet = EDW::Kernels::GetKernelSet();
+
+	for (const auto &benchmark : Benchmarks)
+	{
+		std::printf("%-24s %12.1f ns\n", benchmark.Name, benchmark.Function());
+		EDW::Kernels::SetKernelSet(kernelSet);
+	}
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
@@ -6,8 +6,14 @@
 #include "EDW_AmdLibrary.h"
 #include "EDW_Display.h"
 #include "EDW_DisplayData.h"
+#include "EDW_DisplayDataView.h"
 #include "EDW_DisplayList.h"
+#include "EDW_EdidBuilder.h"
+#include "EDW_EdidSchema.h"
+#include "EDW_Hex.h"
+#include "EDW_Kernels.h"
 #include "EDW_NvidiaLibrary.h"
+#include "EDW_Provisioner.h"
 
 ////////////////////////////////////////////////////////////////////////////
 
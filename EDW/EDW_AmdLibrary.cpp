@@ -52,7 +52,7 @@ namespace EDW
 // Static Variables ////////////////////////////////////////////////////////
 
 std::unique_ptr<EDW::Amd::LibraryImpl> EDW::Amd::Library::impl = nullptr;
-int EDW::Amd::Library::references = 0;
+std::atomic<int> EDW::Amd::Library::references(0);
 
 // Functions ///////////////////////////////////////////////////////////////
 
@@ -75,9 +75,7 @@ EDW::Amd::Library::Library(const Library &other)
 
 EDW::Amd::Library::~Library()
 {
-	--references;
-
-	if (references <= 0)
+	if (--references <= 0)
 		impl.reset();
 }
 
@@ -11,7 +11,10 @@ namespace EDW
 {
 	namespace Amd
 	{
+		const int ADL_OK_WAIT = 4;
 		const int ADL_OK = 0;
+		const int ADL_ERR = -1;
+		const int ADL_ERR_RESOURCE_CONFLICT = -12;
 		const int ADL_MAX_PATH = 256;
 		const int ADL_MAX_EDIDDATA_SIZE = 256;
 	}
@@ -107,7 +110,7 @@ namespace EDW
 
 		private:
 			static std::unique_ptr<struct LibraryImpl> impl;
-			static int references;
+			static std::atomic<int> references;
 		};
 	}
 }
@@ -4,17 +4,27 @@
 // Includes ////////////////////////////////////////////////////////////////
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <iterator>
 #include <limits>
+#include <map>
 #include <memory>
+#include <random>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #define NOMINMAX
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#include <intrin.h>
 
 ////////////////////////////////////////////////////////////////////////////
 
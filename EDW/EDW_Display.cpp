@@ -6,25 +6,113 @@
 
 namespace EDW
 {
+	struct WriteJournal
+	{
+		// Variables ///////////////////////////////////////////////////////
+
+		std::string Identity;
+		unsigned char Address;
+		std::basic_string<unsigned char> OldData;
+		std::basic_string<unsigned char> NewData;
+		WritePlan Plan;
+		std::vector<bool> Completed;
+
+		////////////////////////////////////////////////////////////////////
+	};
+
 	struct DisplayImpl
 	{
+		// Constants ///////////////////////////////////////////////////////
+
+		static const unsigned char SegmentAddress = 0x60;
+		static const int SegmentSize = 256;
+		static const int MinChunkSize = 8;
+		static const int MaxChunkSize = 256;
+		static const int ChunkGrowth = 4;
+		static const int MaxTransactions = 4096;
+		static const int PollInterval = 200;
+		static const int PollTimeout = 50000;
+		static const int MaxPollTimeouts = 3;
+		static const int WriteCycle = 10;
+		static const int DefaultPageSize = 8;
+		static const int MaxProbes = 4;
+		static constexpr int BusSpeeds[] = {10, 33, 100, 400};
+		static const int BusSpeedCount = 4;
+		static const int MaxBusErrors = 3;
+		static const int SpeedProbes = 2;
+		static const int TransferTimeout = 100000;
+
 		// Functions ///////////////////////////////////////////////////////
 
+		DisplayImpl();
+		virtual ~DisplayImpl() = default;
+
 		virtual std::unique_ptr<DisplayImpl> Clone() const = 0;
 		virtual GpuType GetType() const = 0;
-		virtual bool Compare(const std::unique_ptr<DisplayImpl> &impl) const = 0;
+		virtual bool Compare(const std::shared_ptr<DisplayImpl> &impl) const = 0;
+		virtual std::string GetIdentity() = 0;
+		virtual std::string GetBusIdentity() = 0;
 
 		bool Load();
+		DisplayData *GetCache(unsigned char address);
 		bool ReadData(unsigned char address, DisplayData &displayData);
+		bool ReadRange(unsigned char address, int offset, int size, std::basic_string<unsigned char> &data);
+		bool ReadChunk(unsigned char address, int offset, std::basic_string<unsigned char> &data, int size);
+		bool Refresh(unsigned char address, int offset, const std::basic_string<unsigned char> &data);
+		bool WriteCommand(unsigned char address, int offset, const unsigned char *data, int size);
 		bool WriteData(unsigned char address, const DisplayData &oldDisplayData, const DisplayData &newDisplayData, bool fast);
+		bool WriteData(unsigned char address, const DisplayData &displayData, const WritePlan &plan);
+		bool ExecuteWrite(unsigned char address, const DisplayData &displayData, const WritePlan &plan, WriteJournal *writeJournal);
+		bool ProbeWrite(unsigned char address, const DisplayData &displayData, const WritePlan &plan);
+		bool WritePages(unsigned char address, const DisplayData &displayData, const WritePlan &plan, WriteJournal *writeJournal = nullptr);
+		bool LoadJournal(WriteJournal &writeJournal) const;
+		bool SaveJournal(const WriteJournal &writeJournal) const;
+		bool UpdateJournal(int transaction) const;
+		bool DeleteJournal() const;
+		bool VerifyData(unsigned char address, const DisplayData &displayData, const WritePlan &plan, WritePlan &failedPlan);
+		bool WaitReady(unsigned char address);
+		bool PollReady(unsigned char address);
+		static bool Wait(int microseconds);
+		virtual bool IsBusSpeedSupported(int speed) const;
+		bool SetBusSpeed(int speed);
+		bool NegotiateBusSpeed(unsigned char address);
+		bool ProbeBusSpeed(unsigned char address);
+		bool StepDownBusSpeed();
+		static bool IsValidData(const std::basic_string<unsigned char> &data);
+		virtual bool IsSegmentSupported() const;
+		bool RetryTransfer(I2COperation *operations, int count);
+		bool Retry(BusError busError, int attempt);
+		static bool IsValidRetryBudget(const RetryBudget &budget);
+		static bool Backoff(int microseconds);
+		bool ReadBus(unsigned char address, std::basic_string<unsigned char> &data, int size);
+		bool WriteBus(const std::basic_string<unsigned char> &data);
+		bool AddTransaction(unsigned char address, int size, bool read, bool success, std::chrono::steady_clock::time_point start);
 
 		virtual bool ReadI2C(unsigned char address, std::basic_string<unsigned char> &data, int size) = 0;
 		virtual bool WriteI2C(const std::basic_string<unsigned char> &data) = 0;
+		virtual bool Transfer(I2COperation *operations, int count);
 
 		// Variables ///////////////////////////////////////////////////////
 
 		DisplayData edid;
 		DisplayData displayId;
+		int chunkSize;
+		int chunkSuccesses;
+		bool ackPolling;
+		int pollTimeouts;
+		bool writePending;
+		int pageSize;
+		WriteVerification verification;
+		WriteError error;
+		std::wstring journal;
+		int busSpeed;
+		int busErrors;
+		BusStatistics busStatistics;
+		BusError busError;
+		RetryPolicy retryPolicy;
+		RetryStatistics retryStatistics;
+		std::minstd_rand random;
+		std::vector<I2CTransaction> transactions;
 
 		////////////////////////////////////////////////////////////////////
 	};
@@ -38,10 +126,13 @@ namespace EDW
 		static std::unique_ptr<DisplayImpl> Create(int gpu, int output);
 		std::unique_ptr<DisplayImpl> Clone() const;
 		GpuType GetType() const;
-		bool Compare(const std::unique_ptr<DisplayImpl> &impl) const;
+		bool Compare(const std::shared_ptr<DisplayImpl> &impl) const;
+		std::string GetIdentity();
+		std::string GetBusIdentity();
 
 		bool ReadI2C(unsigned char address, std::basic_string<unsigned char> &data, int size);
 		bool WriteI2C(const std::basic_string<unsigned char> &data);
+		static BusError GetBusError(int status);
 
 		// Variables ///////////////////////////////////////////////////////
 
@@ -61,10 +152,16 @@ namespace EDW
 		static std::unique_ptr<DisplayImpl> Create(Nvidia::NvPhysicalGpuHandle gpu, Nvidia::NvU32 output);
 		std::unique_ptr<DisplayImpl> Clone() const;
 		GpuType GetType() const;
-		bool Compare(const std::unique_ptr<DisplayImpl> &impl) const;
+		bool Compare(const std::shared_ptr<DisplayImpl> &impl) const;
+		std::string GetIdentity();
+		std::string GetBusIdentity();
 
 		bool ReadI2C(unsigned char address, std::basic_string<unsigned char> &data, int size);
 		bool WriteI2C(const std::basic_string<unsigned char> &data);
+		bool Transfer(I2COperation *operations, int count);
+		bool IsBusSpeedSupported(int speed) const;
+		Nvidia::NV_I2C_SPEED GetNvidiaBusSpeed() const;
+		static BusError GetBusError(Nvidia::NvAPI_Status status);
 
 		// Variables ///////////////////////////////////////////////////////
 
@@ -74,6 +171,52 @@ namespace EDW
 
 		////////////////////////////////////////////////////////////////////
 	};
+
+	struct SimulatedBus
+	{
+		// Variables ///////////////////////////////////////////////////////
+
+		std::map<unsigned char, std::basic_string<unsigned char>> Memory;
+		std::map<unsigned char, int> Offsets;
+		int Segment;
+		bool Transaction;
+		bool WriteProtected;
+		int MaxSpeed;
+		bool SegmentSupported;
+		int MaxReadSize;
+		int DroppedWrite;
+		int Writes;
+		std::chrono::microseconds WriteCycle;
+		std::chrono::steady_clock::time_point Ready;
+
+		////////////////////////////////////////////////////////////////////
+	};
+
+	struct SimulatedDisplayImpl : public DisplayImpl
+	{
+		// Functions ///////////////////////////////////////////////////////
+
+		SimulatedDisplayImpl(const DisplayData &edid, const DisplayData &displayId, int writeCycle, bool writeProtected, int maxBusSpeed, bool segmentSupported, int maxReadSize, int droppedWrite);
+
+		static std::unique_ptr<DisplayImpl> Create(const DisplayData &edid, const DisplayData &displayId, int writeCycle, bool writeProtected, int maxBusSpeed, bool segmentSupported, int maxReadSize, int droppedWrite);
+		std::unique_ptr<DisplayImpl> Clone() const;
+		GpuType GetType() const;
+		bool Compare(const std::shared_ptr<DisplayImpl> &impl) const;
+		std::string GetIdentity();
+		std::string GetBusIdentity();
+
+		bool ReadI2C(unsigned char address, std::basic_string<unsigned char> &data, int size);
+		bool WriteI2C(const std::basic_string<unsigned char> &data);
+		bool Transfer(I2COperation *operations, int count);
+		bool IsBusSpeedSupported(int speed) const;
+		bool IsSegmentSupported() const;
+
+		// Variables ///////////////////////////////////////////////////////
+
+		std::shared_ptr<SimulatedBus> bus;
+
+		////////////////////////////////////////////////////////////////////
+	};
 }
 
 // Functions ///////////////////////////////////////////////////////////////
@@ -83,7 +226,7 @@ EDW::Display::Display() = default;
 ////////////////////////////////////////////////////////////////////////////
 
 EDW::Display::Display(const Display &other) :
-	impl(other.impl ? other.impl->Clone() : nullptr)
+	impl(other.impl)
 {
 }
 
@@ -91,7 +234,7 @@ EDW::Display::Display(const Display &other) :
 
 EDW::Display &EDW::Display::operator=(const Display &other)
 {
-	impl = other.impl ? other.impl->Clone() : nullptr;
+	impl = other.impl;
 	return *this;
 }
 
@@ -198,6 +341,15 @@ EDW::Display EDW::Display::CreateNvidia(Nvidia::NvPhysicalGpuHandle gpu, Nvidia:
 
 ////////////////////////////////////////////////////////////////////////////
 
+EDW::Display EDW::Display::CreateSimulated(const DisplayData &edid, const DisplayData &displayId, int writeCycle, bool writeProtected, int maxBusSpeed, bool segmentSupported, int maxReadSize, int droppedWrite)
+{
+	Display display;
+	display.impl = SimulatedDisplayImpl::Create(edid, displayId, writeCycle, writeProtected, maxBusSpeed, segmentSupported, maxReadSize, droppedWrite);
+	return display;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 template <class T>
 bool EDW::Display::GetId(T &id)
 {
@@ -222,6 +374,8 @@ template bool EDW::Display::GetName(std::wstring &name);
 
 bool EDW::Display::ReadEdid(DisplayData &displayData)
 {
+	Detach();
+
 	if (!impl->ReadData(0xA0, displayData))
 		return false;
 
@@ -233,6 +387,8 @@ bool EDW::Display::ReadEdid(DisplayData &displayData)
 
 bool EDW::Display::ReadDisplayId(DisplayData &displayData)
 {
+	Detach();
+
 	if (!impl->ReadData(0xA4, displayData))
 		return false;
 
@@ -244,6 +400,8 @@ bool EDW::Display::ReadDisplayId(DisplayData &displayData)
 
 bool EDW::Display::WriteEdid(const DisplayData &displayData, bool fast)
 {
+	Detach();
+
 	if (!impl->WriteData(0xA0, impl->edid, displayData, fast))
 		return false;
 
@@ -253,8 +411,23 @@ bool EDW::Display::WriteEdid(const DisplayData &displayData, bool fast)
 
 ////////////////////////////////////////////////////////////////////////////
 
+bool EDW::Display::WriteEdid(const DisplayData &displayData, const WritePlan &plan)
+{
+	Detach();
+
+	if (!impl->WriteData(0xA0, displayData, plan))
+		return false;
+
+	impl->edid = displayData;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 bool EDW::Display::WriteDisplayId(const DisplayData &displayData, bool fast)
 {
+	Detach();
+
 	if (!impl->WriteData(0xA4, impl->displayId, displayData, fast))
 		return false;
 
@@ -264,261 +437,1833 @@ bool EDW::Display::WriteDisplayId(const DisplayData &displayData, bool fast)
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayImpl::Load()
+bool EDW::Display::WriteDisplayId(const DisplayData &displayData, const WritePlan &plan)
 {
-	return ReadData(0xA0, edid);
+	Detach();
+
+	if (!impl->WriteData(0xA4, displayData, plan))
+		return false;
+
+	impl->displayId = displayData;
+	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayImpl::ReadData(unsigned char address, DisplayData &displayData)
+int EDW::Display::GetPageSize() const
 {
-	if (!WriteI2C({address, 0x00}))
-		return false;
+	return impl->pageSize;
+}
 
-	Sleep(10);
-	std::basic_string<unsigned char> data;
+////////////////////////////////////////////////////////////////////////////
 
-	if (!ReadI2C(address + 1, data, 256))
+bool EDW::Display::SetPageSize(int pageSize)
+{
+	if (pageSize < 1 || pageSize > DisplayImpl::SegmentSize || (pageSize & (pageSize - 1)) != 0)
 		return false;
 
-	displayData = DisplayData(data);
+	Detach();
+	impl->pageSize = pageSize;
 	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayImpl::WriteData(unsigned char address, const DisplayData &oldDisplayData, const DisplayData &newDisplayData, bool fast)
+bool EDW::Display::ReadRange(unsigned char address, int offset, int size, std::basic_string<unsigned char> &data)
 {
-	std::basic_string<unsigned char> oldData;
-	oldDisplayData.GetData(oldData);
+	Detach();
 
-	std::basic_string<unsigned char> newData;
-	newDisplayData.GetData(newData);
-
-	if (fast)
-	{
-		for (int offset = (newDisplayData.GetSize() - 1) / 8 * 8; offset >= 0; offset -= 8)
-		{
-			if (offset < oldDisplayData.GetSize() && newData.substr(offset, 8) == oldData.substr(offset, 8))
-				continue;
+	if (!impl->ReadRange(address, offset, size, data))
+		return false;
 
-			std::basic_string<unsigned char> command;
-			command.push_back(address);
-			command.push_back(offset);
-			command += newData.substr(offset, 8);
+	return impl->Refresh(address, offset, data);
+}
 
-			for (int tries = 1; !WriteI2C(command); ++tries)
-			{
-				if (tries == 10)
-					return false;
+////////////////////////////////////////////////////////////////////////////
 
-				Sleep(10);
-			}
+bool EDW::Display::Transfer(I2COperation *operations, int count)
+{
+	Detach();
+	return impl->Transfer(operations, count);
+}
 
-			Sleep(10);
-		}
-	}
-	else
-	{
-		for (int offset = newDisplayData.GetSize() - 1; offset >= 0; --offset)
-		{
-			if (offset < oldDisplayData.GetSize() && newData[offset] == oldData[offset])
-				continue;
+////////////////////////////////////////////////////////////////////////////
 
-			std::basic_string<unsigned char> command;
-			command.push_back(address);
-			command.push_back(offset);
-			command.push_back(newData[offset]);
+bool EDW::Display::GetEdid(DisplayData &displayData) const
+{
+	displayData = impl->edid;
+	return true;
+}
 
-			for (int tries = 1; !WriteI2C(command); ++tries)
-			{
-				if (tries == 10)
-					return false;
+////////////////////////////////////////////////////////////////////////////
 
-				Sleep(10);
-			}
+bool EDW::Display::GetDisplayId(DisplayData &displayData) const
+{
+	displayData = impl->displayId;
+	return true;
+}
 
-			Sleep(10);
-		}
-	}
+////////////////////////////////////////////////////////////////////////////
 
+bool EDW::Display::GetBusIdentity(std::string &identity)
+{
+	identity = impl->GetBusIdentity();
 	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-EDW::AmdDisplayImpl::AmdDisplayImpl(int gpu, int output) :
-	gpu(gpu),
-	output(output)
+int EDW::Display::GetBusSpeed() const
 {
+	return impl->busSpeed;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-std::unique_ptr<EDW::DisplayImpl> EDW::AmdDisplayImpl::Create(int gpu, int output)
+bool EDW::Display::SetBusSpeed(int speed)
 {
-	std::unique_ptr<DisplayImpl> impl(new AmdDisplayImpl(gpu, output));
+	Detach();
+	return impl->SetBusSpeed(speed);
+}
 
-	if (!impl->Load())
-		return nullptr;
+////////////////////////////////////////////////////////////////////////////
 
-	return impl;
+bool EDW::Display::NegotiateBusSpeed()
+{
+	Detach();
+	return impl->NegotiateBusSpeed(0xA0);
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-std::unique_ptr<EDW::DisplayImpl> EDW::AmdDisplayImpl::Clone() const
+bool EDW::Display::GetBusStatistics(BusStatistics &statistics) const
 {
-	std::unique_ptr<DisplayImpl> impl(new AmdDisplayImpl(*this));
-	return impl;
+	statistics = impl->busStatistics;
+	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-EDW::GpuType EDW::AmdDisplayImpl::GetType() const
+EDW::BusError EDW::Display::GetBusError() const
 {
-	return GpuType::Amd;
+	return impl->busError;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::AmdDisplayImpl::Compare(const std::unique_ptr<DisplayImpl> &impl) const
+bool EDW::Display::GetRetryPolicy(RetryPolicy &policy) const
 {
-	if (GetType() != impl->GetType())
-		return false;
+	policy = impl->retryPolicy;
+	return true;
+}
 
-	const AmdDisplayImpl *other = static_cast<AmdDisplayImpl *>(impl.get());
+////////////////////////////////////////////////////////////////////////////
 
-	if (gpu != other->gpu)
+bool EDW::Display::SetRetryPolicy(const RetryPolicy &policy)
+{
+	if (!DisplayImpl::IsValidRetryBudget(policy.Busy) || !DisplayImpl::IsValidRetryBudget(policy.Timeout) || !DisplayImpl::IsValidRetryBudget(policy.Driver) || !DisplayImpl::IsValidRetryBudget(policy.Mismatch))
 		return false;
 
-	if (output != other->output)
+	if (policy.Jitter < 0 || policy.Jitter > 100)
 		return false;
 
+	Detach();
+	impl->retryPolicy = policy;
 	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::AmdDisplayImpl::ReadI2C(unsigned char address, std::basic_string<unsigned char> &data, int size)
+bool EDW::Display::GetRetryStatistics(RetryStatistics &statistics) const
 {
-	std::vector<unsigned char> buffer(size);
+	statistics = impl->retryStatistics;
+	return true;
+}
 
-	if (amd.ADL_Display_DDCBlockAccess_Get(gpu, output, 0, 0, 1, &address, &size, buffer.data()) != Amd::ADL_OK)
-		return false;
+////////////////////////////////////////////////////////////////////////////
 
-	data.assign(buffer.data(), buffer.size());
+bool EDW::Display::GetTransactions(std::vector<I2CTransaction> &transactions) const
+{
+	transactions = impl->transactions;
 	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::AmdDisplayImpl::WriteI2C(const std::basic_string<unsigned char> &data)
+bool EDW::Display::ClearTransactions()
 {
-	int size = 0;
+	Detach();
+	impl->transactions.clear();
+	return true;
+}
 
-	if (amd.ADL_Display_DDCBlockAccess_Get(gpu, output, 0, 0, static_cast<int>(data.size()), data.data(), &size, nullptr) != Amd::ADL_OK)
-		return false;
+////////////////////////////////////////////////////////////////////////////
+
+EDW::WriteVerification EDW::Display::GetWriteVerification() const
+{
+	return impl->verification;
+}
+
+////////////////////////////////////////////////////////////////////////////
 
+bool EDW::Display::SetWriteVerification(WriteVerification verification)
+{
+	Detach();
+	impl->verification = verification;
 	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-EDW::NvidiaDisplayImpl::NvidiaDisplayImpl(Nvidia::NvPhysicalGpuHandle gpu, Nvidia::NvU32 output) :
-	gpu(gpu),
-	output(output)
+bool EDW::Display::GetAckPolling() const
 {
+	return impl->ackPolling;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-std::unique_ptr<EDW::DisplayImpl> EDW::NvidiaDisplayImpl::Create(Nvidia::NvPhysicalGpuHandle gpu, Nvidia::NvU32 output)
+bool EDW::Display::SetAckPolling(bool ackPolling)
 {
-	std::unique_ptr<DisplayImpl> impl(new NvidiaDisplayImpl(gpu, output));
+	Detach();
+	impl->ackPolling = ackPolling;
+	impl->pollTimeouts = 0;
+	return true;
+}
 
-	if (!impl->Load())
-		return nullptr;
+////////////////////////////////////////////////////////////////////////////
 
-	return impl;
+EDW::WriteError EDW::Display::GetWriteError() const
+{
+	return impl->error;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-EDW::GpuType EDW::NvidiaDisplayImpl::GetType() const
+bool EDW::Display::SetJournal(const std::wstring &file)
 {
-	return GpuType::Nvidia;
+	Detach();
+	impl->journal = file;
+	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::NvidiaDisplayImpl::Compare(const std::unique_ptr<DisplayImpl> &impl) const
+bool EDW::Display::CreateWritePlan(const DisplayData &oldDisplayData, const DisplayData &newDisplayData, int pageSize, WritePlan &plan)
 {
-	if (GetType() != impl->GetType())
+	if (pageSize < 1 || pageSize > DisplayImpl::SegmentSize || (pageSize & (pageSize - 1)) != 0)
 		return false;
 
-	const NvidiaDisplayImpl *other = static_cast<NvidiaDisplayImpl *>(impl.get());
+	const unsigned char *oldData = oldDisplayData.GetView().GetData();
+	const unsigned char *newData = newDisplayData.GetView().GetData();
+	int oldSize = oldDisplayData.GetSize();
+	int newSize = newDisplayData.GetSize();
+	bool tracked = newDisplayData.IsSameOrigin(oldDisplayData) && newSize == oldSize;
 
-	if (gpu != other->gpu)
-		return false;
+	plan.PageSize = pageSize;
+	plan.Transactions.clear();
 
-	if (output != other->output)
-		return false;
+	for (int page = (newSize - 1) / pageSize * pageSize; page >= 0; page -= pageSize)
+	{
+		int end = std::min(page + pageSize, newSize);
+		int first = -1;
+		int last = -1;
+
+		for (int offset = page; offset < end; ++offset)
+		{
+			int line = offset / DisplayData::LineSize;
+
+			if (tracked && !newDisplayData.IsDirtyLine(line) && !oldDisplayData.IsDirtyLine(line))
+				continue;
+
+			if (offset < oldSize && newData[offset] == oldData[offset])
+				continue;
+
+			if (first < 0)
+				first = offset;
+
+			last = offset;
+		}
+
+		if (first >= 0)
+			plan.Transactions.push_back({first, last - first + 1});
+	}
 
 	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-std::unique_ptr<EDW::DisplayImpl> EDW::NvidiaDisplayImpl::Clone() const
+bool EDW::Display::Detach()
 {
-	std::unique_ptr<DisplayImpl> impl(new NvidiaDisplayImpl(*this));
-	return impl;
+	if (impl.use_count() > 1)
+		impl = impl->Clone();
+
+	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::NvidiaDisplayImpl::ReadI2C(unsigned char address, std::basic_string<unsigned char> &data, int size)
+EDW::DisplayImpl::DisplayImpl() :
+	chunkSize(MaxChunkSize),
+	chunkSuccesses(0),
+	ackPolling(true),
+	pollTimeouts(0),
+	writePending(false),
+	pageSize(DefaultPageSize),
+	verification(WriteVerification::Pages),
+	error(WriteError::None),
+	busSpeed(BusSpeeds[0]),
+	busErrors(0),
+	busStatistics(),
+	busError(BusError::None),
+	retryPolicy({{6, 250, 16000}, {2, 10000, 50000}, {1, 1000, 1000}, {1, 1000, 10000}, 25}),
+	retryStatistics(),
+	random(static_cast<unsigned>(std::chrono::steady_clock::now().time_since_epoch().count()))
 {
-	std::vector<unsigned char> buffer(size);
-	Nvidia::NV_I2C_INFO info = {Nvidia::NV_I2C_INFO_VER};
-	info.displayMask = output;
-	info.bIsDDCPort = true;
-	info.i2cDevAddress = address;
-	info.pbI2cRegAddress = nullptr;
-	info.regAddrSize = 0;
-	info.pbData = buffer.data();
-	info.cbSize = static_cast<Nvidia::NvU32>(buffer.size());
-	info.i2cSpeed = Nvidia::NVAPI_I2C_SPEED_DEPRECATED;
-	info.i2cSpeedKhz = Nvidia::NVAPI_I2C_SPEED_10KHZ;
+}
 
-	if (nvidia.NvAPI_I2CRead(gpu, &info) != Nvidia::NVAPI_OK)
-		return false;
+////////////////////////////////////////////////////////////////////////////
 
-	data.assign(buffer.data(), buffer.size());
-	return true;
+bool EDW::DisplayImpl::Load()
+{
+	return ReadData(0xA0, edid);
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::NvidiaDisplayImpl::WriteI2C(const std::basic_string<unsigned char> &data)
+EDW::DisplayData *EDW::DisplayImpl::GetCache(unsigned char address)
 {
-	Nvidia::NV_I2C_INFO info = {Nvidia::NV_I2C_INFO_VER};
-	info.displayMask = output;
-	info.bIsDDCPort = true;
-	info.i2cDevAddress = data[0];
-	info.pbI2cRegAddress = nullptr;
-	info.regAddrSize = 0;
-	info.pbData = const_cast<unsigned char *>(data.data()) + 1;
-	info.cbSize = static_cast<Nvidia::NvU32>(data.size()) - 1;
-	info.i2cSpeed = Nvidia::NVAPI_I2C_SPEED_DEPRECATED;
-	info.i2cSpeedKhz = Nvidia::NVAPI_I2C_SPEED_10KHZ;
+	if (address == 0xA0)
+		return &edid;
+
+	if (address == 0xA4)
+		return &displayId;
+
+	return nullptr;
+}
 
-	if (nvidia.NvAPI_I2CWrite(gpu, &info) != Nvidia::NVAPI_OK)
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::ReadData(unsigned char address, DisplayData &displayData)
+{
+	std::basic_string<unsigned char> data;
+
+	if (!ReadRange(address, 0, SegmentSize, data))
 		return false;
 
+	for (int attempt = 0; !IsValidData(data); ++attempt)
+	{
+		std::basic_string<unsigned char> previousData = data;
+
+		if (!ReadRange(address, 0, SegmentSize, data))
+			return false;
+
+		if (IsValidData(data) || data == previousData)
+			break;
+
+		if (!StepDownBusSpeed() && !Retry(BusError::Mismatch, attempt))
+			break;
+
+		if (!ReadRange(address, 0, SegmentSize, data))
+			return false;
+	}
+
+	int size = DisplayDataView(data).GetReportedSize();
+
+	if (size > DisplayData::MaxSize)
+		size = DisplayData::MaxSize;
+
+	if (size > SegmentSize && !IsSegmentSupported())
+	{
+		busError = BusError::Driver;
+		size = SegmentSize;
+	}
+
+	for (int segment = 1; segment * SegmentSize < size; ++segment)
+	{
+		std::basic_string<unsigned char> segmentData;
+		int segmentSize = size - segment * SegmentSize;
+
+		if (segmentSize > SegmentSize)
+			segmentSize = SegmentSize;
+
+		if (!ReadRange(address, segment * SegmentSize, segmentSize, segmentData))
+			return false;
+
+		data += segmentData;
+	}
+
+	displayData = DisplayData(data);
 	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::ReadRange(unsigned char address, int offset, int size, std::basic_string<unsigned char> &data)
+{
+	if (offset < 0 || size < 1 || offset + size > DisplayData::MaxSize)
+		return false;
+
+	data.clear();
+	int attempt = 0;
+
+	while (size > 0)
+	{
+		int chunk = std::min(chunkSize, size);
+
+		if (chunk > SegmentSize - offset % SegmentSize)
+			chunk = SegmentSize - offset % SegmentSize;
+
+		std::basic_string<unsigned char> chunkData;
+
+		if (!ReadChunk(address, offset, chunkData, chunk))
+		{
+			if (chunkSize == MinChunkSize)
+			{
+				if (!Retry(busError, attempt++))
+					return false;
+
+				continue;
+			}
+
+			chunkSize /= 2;
+			chunkSuccesses = 0;
+			continue;
+		}
+
+		attempt = 0;
+		data += chunkData;
+		offset += chunk;
+		size -= chunk;
+
+		if (++chunkSuccesses == ChunkGrowth)
+		{
+			if (chunkSize < MaxChunkSize)
+				chunkSize *= 2;
+
+			chunkSuccesses = 0;
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::ReadChunk(unsigned char address, int offset, std::basic_string<unsigned char> &data, int size)
+{
+	unsigned char segment = static_cast<unsigned char>(offset / SegmentSize);
+	unsigned char segmentOffset = static_cast<unsigned char>(offset % SegmentSize);
+	data.resize(size);
+
+	I2COperation operations[] =
+	{
+		{SegmentAddress, &segment, 1, nullptr, 0},
+		{address, &segmentOffset, 1, &data[0], size}
+	};
+
+	if (segment > 0)
+		return Transfer(operations, 2);
+
+	return Transfer(operations + 1, 1);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::Refresh(unsigned char address, int offset, const std::basic_string<unsigned char> &data)
+{
+	DisplayData *displayData = GetCache(address);
+
+	if (!displayData)
+		return true;
+
+	std::basic_string<unsigned char> cachedData;
+	displayData->GetData(cachedData);
+
+	if (offset + data.size() > cachedData.size())
+		return true;
+
+	cachedData.replace(offset, data.size(), data);
+	*displayData = DisplayData(cachedData);
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::WriteCommand(unsigned char address, int offset, const unsigned char *data, int size)
+{
+	if (size < 0 || size > SegmentSize)
+		return false;
+
+	unsigned char segment = static_cast<unsigned char>(offset / SegmentSize);
+	unsigned char command[1 + SegmentSize];
+	command[0] = static_cast<unsigned char>(offset % SegmentSize);
+	std::memcpy(command + 1, data, size);
+
+	I2COperation operations[] =
+	{
+		{SegmentAddress, &segment, 1, nullptr, 0},
+		{address, command, 1 + size, nullptr, 0}
+	};
+
+	if (segment > 0)
+		return RetryTransfer(operations, 2);
+
+	return RetryTransfer(operations + 1, 1);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::Transfer(I2COperation *operations, int count)
+{
+	for (int index = 0; index < count; ++index)
+	{
+		const I2COperation &operation = operations[index];
+
+		if (operation.Address != SegmentAddress || operation.WriteSize < 1 || operation.WriteData[0] == 0)
+			continue;
+
+		if (!IsSegmentSupported() || index + 1 == count)
+		{
+			busError = BusError::Driver;
+			return false;
+		}
+	}
+
+	for (int index = 0; index < count; ++index)
+	{
+		const I2COperation &operation = operations[index];
+		unsigned char device = operation.Address == SegmentAddress && index + 1 < count ? operations[index + 1].Address : operation.Address;
+
+		if (writePending && !PollReady(device))
+			return false;
+
+		if (operation.WriteSize > 0 || operation.ReadSize <= 0)
+		{
+			std::basic_string<unsigned char> command(1, operation.Address);
+
+			if (operation.WriteSize > 0)
+				command.append(operation.WriteData, operation.WriteSize);
+
+			if (!WriteBus(command))
+				return false;
+
+			if (operation.WriteSize > 1 && operation.ReadSize <= 0 && operation.Address != SegmentAddress)
+				writePending = true;
+		}
+
+		if (operation.ReadSize > 0)
+		{
+			std::basic_string<unsigned char> data;
+
+			if (!ReadBus(operation.Address + 1, data, operation.ReadSize))
+				return false;
+
+			std::memcpy(operation.ReadData, data.data(), operation.ReadSize);
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::WriteData(unsigned char address, const DisplayData &oldDisplayData, const DisplayData &newDisplayData, bool fast)
+{
+	WritePlan plan;
+
+	if (!Display::CreateWritePlan(oldDisplayData, newDisplayData, fast ? pageSize : 1, plan))
+		return false;
+
+	return WriteData(address, newDisplayData, plan);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::WriteData(unsigned char address, const DisplayData &displayData, const WritePlan &plan)
+{
+	error = WriteError::None;
+
+	for (const WriteTransaction &transaction : plan.Transactions)
+	{
+		if (transaction.Offset + transaction.Size > SegmentSize && !IsSegmentSupported())
+		{
+			busError = BusError::Driver;
+			error = WriteError::Communication;
+			return false;
+		}
+	}
+	WriteJournal writeJournal;
+	WriteJournal *activeJournal = nullptr;
+
+	if (!journal.empty())
+	{
+		std::basic_string<unsigned char> data;
+		displayData.GetData(data);
+
+		if (!LoadJournal(writeJournal) || writeJournal.Identity != GetIdentity() || writeJournal.Address != address || writeJournal.NewData != data)
+		{
+			writeJournal.Identity = GetIdentity();
+			writeJournal.Address = address;
+			writeJournal.OldData.clear();
+			writeJournal.NewData = data;
+			writeJournal.Plan = plan;
+			writeJournal.Completed.assign(plan.Transactions.size(), false);
+
+			if (GetCache(address))
+				GetCache(address)->GetData(writeJournal.OldData);
+
+			if (!SaveJournal(writeJournal))
+			{
+				error = WriteError::Journal;
+				return false;
+			}
+		}
+
+		activeJournal = &writeJournal;
+	}
+
+	if (!ExecuteWrite(address, displayData, activeJournal ? writeJournal.Plan : plan, activeJournal))
+		return false;
+
+	if (activeJournal && !DeleteJournal())
+	{
+		error = WriteError::Journal;
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::ExecuteWrite(unsigned char address, const DisplayData &displayData, const WritePlan &plan, WriteJournal *writeJournal)
+{
+	if (!ProbeWrite(address, displayData, plan))
+		return false;
+
+	if (!WritePages(address, displayData, plan, writeJournal))
+	{
+		if (error == WriteError::None)
+			error = WriteError::Communication;
+
+		return false;
+	}
+
+	if (verification == WriteVerification::None)
+		return true;
+
+	WritePlan failedPlan;
+
+	if (!VerifyData(address, displayData, plan, failedPlan))
+	{
+		error = WriteError::Communication;
+		return false;
+	}
+
+	for (int attempt = 0; !failedPlan.Transactions.empty(); ++attempt)
+	{
+		if (!Retry(BusError::Mismatch, attempt))
+		{
+			error = WriteError::Verification;
+			return false;
+		}
+
+		if (!WritePages(address, displayData, failedPlan))
+		{
+			error = WriteError::Communication;
+			return false;
+		}
+
+		WritePlan remainingPlan;
+
+		if (!VerifyData(address, displayData, failedPlan, remainingPlan))
+		{
+			error = WriteError::Communication;
+			return false;
+		}
+
+		failedPlan = remainingPlan;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::ProbeWrite(unsigned char address, const DisplayData &displayData, const WritePlan &plan)
+{
+	const unsigned char *data = displayData.GetView().GetData();
+	int probes = 0;
+
+	for (const WriteTransaction &transaction : plan.Transactions)
+	{
+		for (int offset = transaction.Offset; offset < transaction.Offset + transaction.Size; ++offset)
+		{
+			if (probes++ == MaxProbes)
+				return true;
+
+			std::basic_string<unsigned char> oldData;
+
+			if (!ReadRange(address, offset, 1, oldData))
+			{
+				error = WriteError::Communication;
+				return false;
+			}
+
+			if (oldData[0] == data[offset])
+				continue;
+
+			while (!WriteCommand(address, offset, data + offset, 1))
+			{
+				if (!StepDownBusSpeed())
+				{
+					error = WriteError::Communication;
+					return false;
+				}
+			}
+
+			if (!WaitReady(address))
+			{
+				error = WriteError::Communication;
+				return false;
+			}
+
+			std::basic_string<unsigned char> newData;
+
+			if (!ReadRange(address, offset, 1, newData))
+			{
+				error = WriteError::Communication;
+				return false;
+			}
+
+			if (newData[0] == data[offset])
+				return true;
+
+			if (newData[0] != oldData[0])
+			{
+				if (!WriteCommand(address, offset, oldData.data(), 1) || !WaitReady(address))
+				{
+					error = WriteError::Communication;
+					return false;
+				}
+
+				error = WriteError::Verification;
+				return false;
+			}
+
+			error = WriteError::WriteProtected;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::WritePages(unsigned char address, const DisplayData &displayData, const WritePlan &plan, WriteJournal *writeJournal)
+{
+	const unsigned char *data = displayData.GetView().GetData();
+
+	for (std::size_t index = 0; index < plan.Transactions.size(); ++index)
+	{
+		const WriteTransaction &transaction = plan.Transactions[index];
+
+		if (writeJournal && writeJournal->Completed[index])
+			continue;
+
+		if (transaction.Offset < 0 || transaction.Size < 1 || transaction.Offset + transaction.Size > displayData.GetSize())
+			return false;
+
+		if (!WriteCommand(address, transaction.Offset, data + transaction.Offset, transaction.Size) || !WaitReady(address))
+			return false;
+
+		if (writeJournal)
+		{
+			writeJournal->Completed[index] = true;
+
+			if (!UpdateJournal(static_cast<int>(index)))
+			{
+				error = WriteError::Journal;
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::LoadJournal(WriteJournal &writeJournal) const
+{
+	std::ifstream stream(journal, std::ios::binary);
+
+	if (!stream)
+		return false;
+
+	std::string text((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	stream.close();
+
+	std::size_t end = text.rfind('\n');
+
+	if (end == std::string::npos)
+		return false;
+
+	std::istringstream lines(text.substr(0, end + 1));
+	std::string line;
+
+	if (!std::getline(lines, line) || line != "EDW JOURNAL 1")
+		return false;
+
+	if (!std::getline(lines, writeJournal.Identity))
+		return false;
+
+	int address;
+	std::string oldText;
+	std::string newText;
+
+	if (!(lines >> address) || !lines.ignore() || !std::getline(lines, oldText) || !std::getline(lines, newText))
+		return false;
+
+	writeJournal.Address = static_cast<unsigned char>(address);
+
+	std::vector<unsigned char> buffer;
+	writeJournal.OldData.clear();
+	writeJournal.NewData.clear();
+
+	if (!oldText.empty())
+	{
+		if (!Hex::Decode(buffer, oldText.data(), oldText.size()))
+			return false;
+
+		writeJournal.OldData.assign(buffer.data(), buffer.size());
+	}
+
+	if (!Hex::Decode(buffer, newText.data(), newText.size()))
+		return false;
+
+	writeJournal.NewData.assign(buffer.data(), buffer.size());
+
+	int count;
+
+	if (!(lines >> writeJournal.Plan.PageSize >> count) || count < 0)
+		return false;
+
+	writeJournal.Plan.Transactions.resize(count);
+	writeJournal.Completed.assign(count, false);
+
+	for (WriteTransaction &transaction : writeJournal.Plan.Transactions)
+	{
+		if (!(lines >> transaction.Offset >> transaction.Size))
+			return false;
+
+		if (transaction.Offset < 0 || transaction.Size < 1 || transaction.Offset + transaction.Size > static_cast<int>(writeJournal.NewData.size()))
+			return false;
+	}
+
+	int index;
+
+	while (lines >> index)
+	{
+		if (index >= 0 && index < count)
+			writeJournal.Completed[index] = true;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::SaveJournal(const WriteJournal &writeJournal) const
+{
+	std::string text = "EDW JOURNAL 1\n";
+	text += writeJournal.Identity + "\n";
+	text += std::to_string(writeJournal.Address) + "\n";
+
+	std::string hex;
+	Hex::Encode(hex, writeJournal.OldData.data(), static_cast<int>(writeJournal.OldData.size()));
+	text += hex + "\n";
+	Hex::Encode(hex, writeJournal.NewData.data(), static_cast<int>(writeJournal.NewData.size()));
+	text += hex + "\n";
+
+	text += std::to_string(writeJournal.Plan.PageSize) + " " + std::to_string(writeJournal.Plan.Transactions.size()) + "\n";
+
+	for (const WriteTransaction &transaction : writeJournal.Plan.Transactions)
+		text += std::to_string(transaction.Offset) + " " + std::to_string(transaction.Size) + "\n";
+
+	for (std::size_t index = 0; index < writeJournal.Completed.size(); ++index)
+	{
+		if (writeJournal.Completed[index])
+			text += std::to_string(index) + "\n";
+	}
+
+	std::wstring file = journal + L".tmp";
+	HANDLE handle = CreateFileW(file.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (handle == INVALID_HANDLE_VALUE)
+		return false;
+
+	DWORD written = 0;
+	bool success = WriteFile(handle, text.data(), static_cast<DWORD>(text.size()), &written, nullptr) && written == text.size() && FlushFileBuffers(handle);
+	CloseHandle(handle);
+
+	if (!success)
+		return false;
+
+	return MoveFileExW(file.c_str(), journal.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::UpdateJournal(int transaction) const
+{
+	HANDLE handle = CreateFileW(journal.c_str(), FILE_APPEND_DATA, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (handle == INVALID_HANDLE_VALUE)
+		return false;
+
+	std::string text = std::to_string(transaction) + "\n";
+	DWORD written = 0;
+	bool success = WriteFile(handle, text.data(), static_cast<DWORD>(text.size()), &written, nullptr) && written == text.size() && FlushFileBuffers(handle);
+	CloseHandle(handle);
+	return success;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::DeleteJournal() const
+{
+	return DeleteFileW(journal.c_str()) != 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::WaitReady(unsigned char address)
+{
+	for (int attempt = 0; !PollReady(address); ++attempt)
+	{
+		if (ackPolling && !Retry(busError, attempt))
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::PollReady(unsigned char address)
+{
+	if (!ackPolling)
+	{
+		Sleep(WriteCycle);
+		writePending = false;
+		return true;
+	}
+
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+
+	LARGE_INTEGER start;
+	QueryPerformanceCounter(&start);
+
+	while (!WriteBus({address}))
+	{
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+
+		if ((now.QuadPart - start.QuadPart) * 1000000 / frequency.QuadPart >= PollTimeout)
+		{
+			if (++pollTimeouts == MaxPollTimeouts)
+				ackPolling = false;
+
+			busError = BusError::Timeout;
+			return false;
+		}
+
+		Wait(PollInterval);
+	}
+
+	pollTimeouts = 0;
+	writePending = false;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::Wait(int microseconds)
+{
+	if (microseconds > 0)
+		Sleep((microseconds + 999) / 1000);
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::VerifyData(unsigned char address, const DisplayData &displayData, const WritePlan &plan, WritePlan &failedPlan)
+{
+	DisplayDataView view = displayData.GetView();
+	const unsigned char *data = view.GetData();
+	std::map<int, bool> checksums;
+
+	failedPlan.PageSize = 1;
+	failedPlan.Transactions.clear();
+
+	for (const WriteTransaction &transaction : plan.Transactions)
+	{
+		if (verification == WriteVerification::Checksums)
+		{
+			int checksum = view.GetChecksumOffset(transaction.Offset);
+
+			if (checksum >= 0 && checksums.find(checksum) == checksums.end())
+			{
+				int offset = view.IsEdid() ? checksum - 127 : checksum / 256 * 256;
+				int size = checksum - offset + 1;
+				int written = 0;
+				checksums[checksum] = false;
+
+				for (const WriteTransaction &blockTransaction : plan.Transactions)
+					written += std::max(0, std::min(blockTransaction.Offset + blockTransaction.Size, offset + size) - std::max(blockTransaction.Offset, offset));
+
+				if (written * 2 >= size)
+				{
+					std::basic_string<unsigned char> blockData;
+
+					if (!ReadRange(address, offset, size, blockData))
+						return false;
+
+					checksums[checksum] = Kernels::IsEqual(blockData.data(), data + offset, size);
+				}
+			}
+
+			if (checksum >= 0 && checksums[checksum])
+				continue;
+		}
+
+		std::basic_string<unsigned char> pageData;
+
+		if (!ReadRange(address, transaction.Offset, transaction.Size, pageData))
+			return false;
+
+		for (int index = transaction.Size - 1; index >= 0; --index)
+		{
+			if (pageData[index] != data[transaction.Offset + index])
+				failedPlan.Transactions.push_back({transaction.Offset + index, 1});
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::IsBusSpeedSupported(int speed) const
+{
+	return speed == BusSpeeds[0];
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::SetBusSpeed(int speed)
+{
+	if (!IsBusSpeedSupported(speed))
+		return false;
+
+	busSpeed = speed;
+	busErrors = 0;
+	chunkSize = MaxChunkSize;
+	chunkSuccesses = 0;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::NegotiateBusSpeed(unsigned char address)
+{
+	int oldSpeed = busSpeed;
+
+	for (int index = BusSpeedCount - 1; index >= 0; --index)
+	{
+		if (!SetBusSpeed(BusSpeeds[index]))
+			continue;
+
+		if (ProbeBusSpeed(address))
+			return true;
+	}
+
+	SetBusSpeed(oldSpeed);
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::ProbeBusSpeed(unsigned char address)
+{
+	std::basic_string<unsigned char> firstData;
+
+	for (int probe = 0; probe < SpeedProbes; ++probe)
+	{
+		std::basic_string<unsigned char> data;
+
+		if (!ReadRange(address, 0, SegmentSize, data) || !IsValidData(data))
+			return false;
+
+		if (probe > 0 && data != firstData)
+			return false;
+
+		firstData = data;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::StepDownBusSpeed()
+{
+	for (int index = BusSpeedCount - 1; index >= 0; --index)
+	{
+		if (BusSpeeds[index] >= busSpeed || !IsBusSpeedSupported(BusSpeeds[index]))
+			continue;
+
+		SetBusSpeed(BusSpeeds[index]);
+		++busStatistics.StepDowns;
+		return true;
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::IsValidData(const std::basic_string<unsigned char> &data)
+{
+	DisplayDataView view(data);
+
+	if (view.IsEdid())
+		return view.IsValidEdidChecksums();
+
+	if (view.IsDisplayId())
+		return view.IsValidDisplayIdChecksums();
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::IsSegmentSupported() const
+{
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::RetryTransfer(I2COperation *operations, int count)
+{
+	for (int attempt = 0; !Transfer(operations, count); ++attempt)
+	{
+		if (!Retry(busError, attempt))
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::Retry(BusError busError, int attempt)
+{
+	const RetryBudget *budget = nullptr;
+	int *retries = nullptr;
+
+	switch (busError)
+	{
+		case BusError::Busy:
+			budget = &retryPolicy.Busy;
+			retries = &retryStatistics.BusyRetries;
+			break;
+
+		case BusError::Timeout:
+			budget = &retryPolicy.Timeout;
+			retries = &retryStatistics.TimeoutRetries;
+			break;
+
+		case BusError::Driver:
+			budget = &retryPolicy.Driver;
+			retries = &retryStatistics.DriverRetries;
+			break;
+
+		case BusError::Mismatch:
+			budget = &retryPolicy.Mismatch;
+			retries = &retryStatistics.MismatchRetries;
+			break;
+
+		default:
+			return false;
+	}
+
+	if (attempt >= budget->Retries)
+	{
+		++retryStatistics.Failures;
+		return false;
+	}
+
+	long long backoff = budget->Backoff;
+
+	for (int index = 0; index < attempt && backoff < budget->MaxBackoff; ++index)
+		backoff *= 2;
+
+	if (backoff > budget->MaxBackoff)
+		backoff = budget->MaxBackoff;
+
+	if (retryPolicy.Jitter > 0)
+	{
+		long long jitter = backoff * retryPolicy.Jitter / 100;
+		backoff += std::uniform_int_distribution<long long>(-jitter, jitter)(random);
+	}
+
+	++*retries;
+	retryStatistics.WastedTime += backoff;
+	Backoff(static_cast<int>(backoff));
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::IsValidRetryBudget(const RetryBudget &budget)
+{
+	return budget.Retries >= 0 && budget.Backoff >= 0 && budget.MaxBackoff >= budget.Backoff;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::Backoff(int microseconds)
+{
+	return Wait(microseconds);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::ReadBus(unsigned char address, std::basic_string<unsigned char> &data, int size)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	busError = BusError::None;
+	bool success = ReadI2C(address, data, size);
+
+	if (success && static_cast<int>(data.size()) != size)
+	{
+		busError = BusError::Mismatch;
+		success = false;
+	}
+
+	return AddTransaction(address, size, true, success, start) && success;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::WriteBus(const std::basic_string<unsigned char> &data)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	busError = BusError::None;
+	bool success = WriteI2C(data);
+	return AddTransaction(data[0], static_cast<int>(data.size()) - 1, false, success, start) && success;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayImpl::AddTransaction(unsigned char address, int size, bool read, bool success, std::chrono::steady_clock::time_point start)
+{
+	std::chrono::microseconds duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+	if (transactions.size() >= MaxTransactions)
+		transactions.erase(transactions.begin(), transactions.begin() + MaxTransactions / 2);
+
+	transactions.push_back({address, size, read, success, duration.count()});
+
+	if (size > 0)
+	{
+		++busStatistics.Transfers;
+
+		if (success)
+		{
+			busErrors = 0;
+		}
+		else
+		{
+			++busStatistics.Errors;
+			retryStatistics.WastedTime += duration.count();
+
+			if (++busErrors >= MaxBusErrors)
+				StepDownBusSpeed();
+		}
+	}
+
+	if (!success)
+	{
+		if (duration.count() >= TransferTimeout && busError != BusError::Driver)
+			busError = BusError::Timeout;
+		else if (busError == BusError::None)
+			busError = BusError::Driver;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::AmdDisplayImpl::AmdDisplayImpl(int gpu, int output) :
+	gpu(gpu),
+	output(output)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<EDW::DisplayImpl> EDW::AmdDisplayImpl::Create(int gpu, int output)
+{
+	std::unique_ptr<DisplayImpl> impl(new AmdDisplayImpl(gpu, output));
+
+	if (!impl->Load())
+		return nullptr;
+
+	return impl;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<EDW::DisplayImpl> EDW::AmdDisplayImpl::Clone() const
+{
+	std::unique_ptr<DisplayImpl> impl(new AmdDisplayImpl(*this));
+	return impl;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::GpuType EDW::AmdDisplayImpl::GetType() const
+{
+	return GpuType::Amd;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::AmdDisplayImpl::Compare(const std::shared_ptr<DisplayImpl> &impl) const
+{
+	if (GetType() != impl->GetType())
+		return false;
+
+	const AmdDisplayImpl *other = static_cast<AmdDisplayImpl *>(impl.get());
+
+	if (gpu != other->gpu)
+		return false;
+
+	if (output != other->output)
+		return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::string EDW::AmdDisplayImpl::GetIdentity()
+{
+	return "Amd " + std::to_string(gpu) + " " + std::to_string(output);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::string EDW::AmdDisplayImpl::GetBusIdentity()
+{
+	return "Amd " + std::to_string(gpu);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::AmdDisplayImpl::ReadI2C(unsigned char address, std::basic_string<unsigned char> &data, int size)
+{
+	std::vector<unsigned char> buffer(size);
+	int status = amd.ADL_Display_DDCBlockAccess_Get(gpu, output, 0, 0, 1, &address, &size, buffer.data());
+
+	if (status != Amd::ADL_OK)
+	{
+		busError = GetBusError(status);
+		return false;
+	}
+
+	data.assign(buffer.data(), buffer.size());
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::AmdDisplayImpl::WriteI2C(const std::basic_string<unsigned char> &data)
+{
+	int size = 0;
+	int status = amd.ADL_Display_DDCBlockAccess_Get(gpu, output, 0, 0, static_cast<int>(data.size()), data.data(), &size, nullptr);
+
+	if (status != Amd::ADL_OK)
+	{
+		busError = GetBusError(status);
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::BusError EDW::AmdDisplayImpl::GetBusError(int status)
+{
+	switch (status)
+	{
+		case Amd::ADL_OK:
+			return BusError::None;
+
+		case Amd::ADL_OK_WAIT:
+		case Amd::ADL_ERR_RESOURCE_CONFLICT:
+			return BusError::Busy;
+
+		default:
+			return BusError::Driver;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::NvidiaDisplayImpl::NvidiaDisplayImpl(Nvidia::NvPhysicalGpuHandle gpu, Nvidia::NvU32 output) :
+	gpu(gpu),
+	output(output)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<EDW::DisplayImpl> EDW::NvidiaDisplayImpl::Create(Nvidia::NvPhysicalGpuHandle gpu, Nvidia::NvU32 output)
+{
+	std::unique_ptr<DisplayImpl> impl(new NvidiaDisplayImpl(gpu, output));
+
+	if (!impl->Load())
+		return nullptr;
+
+	return impl;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::GpuType EDW::NvidiaDisplayImpl::GetType() const
+{
+	return GpuType::Nvidia;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::NvidiaDisplayImpl::Compare(const std::shared_ptr<DisplayImpl> &impl) const
+{
+	if (GetType() != impl->GetType())
+		return false;
+
+	const NvidiaDisplayImpl *other = static_cast<NvidiaDisplayImpl *>(impl.get());
+
+	if (gpu != other->gpu)
+		return false;
+
+	if (output != other->output)
+		return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<EDW::DisplayImpl> EDW::NvidiaDisplayImpl::Clone() const
+{
+	std::unique_ptr<DisplayImpl> impl(new NvidiaDisplayImpl(*this));
+	return impl;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::string EDW::NvidiaDisplayImpl::GetIdentity()
+{
+	Nvidia::NvPhysicalGpuHandle gpuList[Nvidia::NVAPI_MAX_PHYSICAL_GPUS];
+	Nvidia::NvU32 gpuCount;
+	Nvidia::NvU32 gpuIndex = 0;
+
+	if (nvidia.NvAPI_EnumPhysicalGPUs(gpuList, &gpuCount) == Nvidia::NVAPI_OK)
+	{
+		while (gpuIndex < gpuCount && gpuList[gpuIndex] != gpu)
+			++gpuIndex;
+	}
+
+	return "Nvidia " + std::to_string(gpuIndex) + " " + std::to_string(output);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::string EDW::NvidiaDisplayImpl::GetBusIdentity()
+{
+	return "Nvidia " + std::to_string(reinterpret_cast<std::uintptr_t>(gpu));
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::NvidiaDisplayImpl::ReadI2C(unsigned char address, std::basic_string<unsigned char> &data, int size)
+{
+	std::vector<unsigned char> buffer(size);
+	Nvidia::NV_I2C_INFO info = {Nvidia::NV_I2C_INFO_VER};
+	info.displayMask = output;
+	info.bIsDDCPort = true;
+	info.i2cDevAddress = address;
+	info.pbI2cRegAddress = nullptr;
+	info.regAddrSize = 0;
+	info.pbData = buffer.data();
+	info.cbSize = static_cast<Nvidia::NvU32>(buffer.size());
+	info.i2cSpeed = Nvidia::NVAPI_I2C_SPEED_DEPRECATED;
+	info.i2cSpeedKhz = GetNvidiaBusSpeed();
+	Nvidia::NvAPI_Status status = nvidia.NvAPI_I2CRead(gpu, &info);
+
+	if (status != Nvidia::NVAPI_OK)
+	{
+		busError = GetBusError(status);
+		return false;
+	}
+
+	data.assign(buffer.data(), buffer.size());
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::NvidiaDisplayImpl::Transfer(I2COperation *operations, int count)
+{
+	for (int index = 0; index < count; ++index)
+	{
+		I2COperation &operation = operations[index];
+
+		if (operation.WriteSize <= 0 || operation.ReadSize <= 0)
+		{
+			if (!DisplayImpl::Transfer(&operation, 1))
+				return false;
+
+			continue;
+		}
+
+		if (writePending && !PollReady(operation.Address))
+			return false;
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		Nvidia::NV_I2C_INFO info = {Nvidia::NV_I2C_INFO_VER};
+		info.displayMask = output;
+		info.bIsDDCPort = true;
+		info.i2cDevAddress = operation.Address + 1;
+		info.pbI2cRegAddress = const_cast<unsigned char *>(operation.WriteData);
+		info.regAddrSize = static_cast<Nvidia::NvU32>(operation.WriteSize);
+		info.pbData = operation.ReadData;
+		info.cbSize = static_cast<Nvidia::NvU32>(operation.ReadSize);
+		info.i2cSpeed = Nvidia::NVAPI_I2C_SPEED_DEPRECATED;
+		info.i2cSpeedKhz = GetNvidiaBusSpeed();
+
+		Nvidia::NvAPI_Status status = nvidia.NvAPI_I2CRead(gpu, &info);
+		bool success = status == Nvidia::NVAPI_OK;
+		busError = GetBusError(status);
+		AddTransaction(operation.Address + 1, operation.ReadSize, true, success, start);
+
+		if (!success)
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::NvidiaDisplayImpl::IsBusSpeedSupported(int speed) const
+{
+	return speed == 10 || speed == 33 || speed == 100 || speed == 400;
+}
+
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::Nvidia::NV_I2C_SPEED EDW::NvidiaDisplayImpl::GetNvidiaBusSpeed() const
+{
+	if (busSpeed >= 400)
+		return Nvidia::NVAPI_I2C_SPEED_400KHZ;
+
+	if (busSpeed >= 100)
+		return Nvidia::NVAPI_I2C_SPEED_100KHZ;
+
+	if (busSpeed >= 33)
+		return Nvidia::NVAPI_I2C_SPEED_33KHZ;
+
+	return Nvidia::NVAPI_I2C_SPEED_10KHZ;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::NvidiaDisplayImpl::WriteI2C(const std::basic_string<unsigned char> &data)
+{
+	Nvidia::NV_I2C_INFO info = {Nvidia::NV_I2C_INFO_VER};
+	info.displayMask = output;
+	info.bIsDDCPort = true;
+	info.i2cDevAddress = data[0];
+	info.pbI2cRegAddress = nullptr;
+	info.regAddrSize = 0;
+	info.pbData = const_cast<unsigned char *>(data.data()) + 1;
+	info.cbSize = static_cast<Nvidia::NvU32>(data.size()) - 1;
+	info.i2cSpeed = Nvidia::NVAPI_I2C_SPEED_DEPRECATED;
+	info.i2cSpeedKhz = GetNvidiaBusSpeed();
+	Nvidia::NvAPI_Status status = nvidia.NvAPI_I2CWrite(gpu, &info);
+
+	if (status != Nvidia::NVAPI_OK)
+	{
+		busError = GetBusError(status);
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::BusError EDW::NvidiaDisplayImpl::GetBusError(Nvidia::NvAPI_Status status)
+{
+	switch (status)
+	{
+		case Nvidia::NVAPI_OK:
+			return BusError::None;
+
+		case Nvidia::NVAPI_API_IN_USE:
+			return BusError::Busy;
+
+		case Nvidia::NVAPI_TIMEOUT:
+			return BusError::Timeout;
+
+		default:
+			return BusError::Driver;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::SimulatedDisplayImpl::SimulatedDisplayImpl(const DisplayData &edid, const DisplayData &displayId, int writeCycle, bool writeProtected, int maxBusSpeed, bool segmentSupported, int maxReadSize, int droppedWrite) :
+	bus(std::make_shared<SimulatedBus>())
+{
+	const unsigned char addresses[] = {0xA0, 0xA4};
+	const DisplayData *displayData[] = {&edid, &displayId};
+
+	for (int index = 0; index < 2; ++index)
+	{
+		std::basic_string<unsigned char> data;
+		displayData[index]->GetData(data);
+
+		if (data.empty())
+			continue;
+
+		data.resize((data.size() + SegmentSize - 1) / SegmentSize * SegmentSize, 0xFF);
+		bus->Memory[addresses[index]] = data;
+		bus->Offsets[addresses[index]] = 0;
+	}
+
+	bus->Segment = 0;
+	bus->Transaction = false;
+	bus->WriteProtected = writeProtected;
+	bus->MaxSpeed = maxBusSpeed;
+	bus->SegmentSupported = segmentSupported;
+	bus->MaxReadSize = maxReadSize;
+	bus->DroppedWrite = droppedWrite;
+	bus->Writes = 0;
+	bus->WriteCycle = std::chrono::microseconds(writeCycle);
+	bus->Ready = std::chrono::steady_clock::now();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<EDW::DisplayImpl> EDW::SimulatedDisplayImpl::Create(const DisplayData &edid, const DisplayData &displayId, int writeCycle, bool writeProtected, int maxBusSpeed, bool segmentSupported, int maxReadSize, int droppedWrite)
+{
+	std::unique_ptr<DisplayImpl> impl(new SimulatedDisplayImpl(edid, displayId, writeCycle, writeProtected, maxBusSpeed, segmentSupported, maxReadSize, droppedWrite));
+
+	if (!impl->Load())
+		return nullptr;
+
+	return impl;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<EDW::DisplayImpl> EDW::SimulatedDisplayImpl::Clone() const
+{
+	std::unique_ptr<DisplayImpl> impl(new SimulatedDisplayImpl(*this));
+	return impl;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::GpuType EDW::SimulatedDisplayImpl::GetType() const
+{
+	return GpuType::Simulated;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::SimulatedDisplayImpl::Compare(const std::shared_ptr<DisplayImpl> &impl) const
+{
+	if (GetType() != impl->GetType())
+		return false;
+
+	const SimulatedDisplayImpl *other = static_cast<SimulatedDisplayImpl *>(impl.get());
+
+	if (bus != other->bus)
+		return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::string EDW::SimulatedDisplayImpl::GetIdentity()
+{
+	return "Simulated " + std::to_string(reinterpret_cast<std::uintptr_t>(bus.get()));
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::string EDW::SimulatedDisplayImpl::GetBusIdentity()
+{
+	return GetIdentity();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::SimulatedDisplayImpl::IsBusSpeedSupported(int speed) const
+{
+	return speed == 10 || speed == 33 || speed == 100 || speed == 400;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::SimulatedDisplayImpl::IsSegmentSupported() const
+{
+	return bus->SegmentSupported;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::SimulatedDisplayImpl::ReadI2C(unsigned char address, std::basic_string<unsigned char> &data, int size)
+{
+	unsigned char device = address & 0xFE;
+
+	if (bus->Memory.find(device) == bus->Memory.end())
+	{
+		busError = BusError::Busy;
+		return false;
+	}
+
+	if (std::chrono::steady_clock::now() < bus->Ready || size > bus->MaxReadSize)
+	{
+		busError = BusError::Busy;
+		return false;
+	}
+
+	const std::basic_string<unsigned char> &memory = bus->Memory[device];
+	int &offset = bus->Offsets[device];
+	int base = offset / SegmentSize * SegmentSize;
+	data.clear();
+
+	for (int index = 0; index < size; ++index)
+	{
+		data.push_back(memory[offset]);
+		offset = base + (offset - base + 1) % SegmentSize;
+	}
+
+	if (busSpeed > bus->MaxSpeed && !data.empty())
+		data.back() ^= static_cast<unsigned char>(random() | 1);
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::SimulatedDisplayImpl::WriteI2C(const std::basic_string<unsigned char> &data)
+{
+	if (data.empty())
+	{
+		busError = BusError::Busy;
+		return false;
+	}
+
+	if (data[0] == SegmentAddress)
+	{
+		if (data.size() < 2)
+		{
+			busError = BusError::Busy;
+			return false;
+		}
+
+		bus->Segment = bus->Transaction ? data[1] : 0;
+		return true;
+	}
+
+	int base = bus->Segment * SegmentSize;
+
+	if (bus->Memory.find(data[0]) == bus->Memory.end())
+	{
+		busError = BusError::Busy;
+		return false;
+	}
+
+	if (std::chrono::steady_clock::now() < bus->Ready)
+	{
+		busError = BusError::Busy;
+		return false;
+	}
+
+	if (data.size() < 2)
+		return true;
+
+	if (busSpeed > bus->MaxSpeed && data.size() > 2)
+	{
+		busError = BusError::Busy;
+		return false;
+	}
+
+	std::basic_string<unsigned char> &memory = bus->Memory[data[0]];
+
+	if (base >= static_cast<int>(memory.size()))
+	{
+		busError = BusError::Busy;
+		return false;
+	}
+
+	int offset = data[1];
+	bool dropped = data.size() > 2 && ++bus->Writes == bus->DroppedWrite;
+
+	for (std::size_t index = 2; index < data.size(); ++index)
+	{
+		if (!bus->WriteProtected && !dropped)
+			memory[base + offset] = data[index];
+
+		offset = (offset + 1) % SegmentSize;
+	}
+
+	bus->Offsets[data[0]] = base + offset;
+
+	if (data.size() > 2)
+		bus->Ready = std::chrono::steady_clock::now() + bus->WriteCycle;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::SimulatedDisplayImpl::Transfer(I2COperation *operations, int count)
+{
+	bus->Transaction = true;
+	bool success = DisplayImpl::Transfer(operations, count);
+	bus->Transaction = false;
+	bus->Segment = 0;
+	return success;
+}
+
+////////////////////////////////////////////////////////////////////////////
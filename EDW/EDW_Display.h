@@ -14,7 +14,101 @@ namespace EDW
 	enum class GpuType
 	{
 		Amd,
-		Nvidia
+		Nvidia,
+		Simulated
+	};
+
+	enum class WriteVerification
+	{
+		None,
+		Pages,
+		Checksums
+	};
+
+	enum class WriteError
+	{
+		None,
+		Communication,
+		WriteProtected,
+		Verification,
+		Journal
+	};
+
+	enum class BusError
+	{
+		None,
+		Busy,
+		Timeout,
+		Driver,
+		Mismatch
+	};
+}
+
+// Structs /////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	struct I2CTransaction
+	{
+		unsigned char Address;
+		int Size;
+		bool Read;
+		bool Success;
+		long long Duration;
+	};
+
+	struct I2COperation
+	{
+		unsigned char Address;
+		const unsigned char *WriteData;
+		int WriteSize;
+		unsigned char *ReadData;
+		int ReadSize;
+	};
+
+	struct BusStatistics
+	{
+		int Transfers;
+		int Errors;
+		int StepDowns;
+	};
+
+	struct RetryBudget
+	{
+		int Retries;
+		int Backoff;
+		int MaxBackoff;
+	};
+
+	struct RetryPolicy
+	{
+		RetryBudget Busy;
+		RetryBudget Timeout;
+		RetryBudget Driver;
+		RetryBudget Mismatch;
+		int Jitter;
+	};
+
+	struct RetryStatistics
+	{
+		int BusyRetries;
+		int TimeoutRetries;
+		int DriverRetries;
+		int MismatchRetries;
+		int Failures;
+		long long WastedTime;
+	};
+
+	struct WriteTransaction
+	{
+		int Offset;
+		int Size;
+	};
+
+	struct WritePlan
+	{
+		int PageSize;
+		std::vector<WriteTransaction> Transactions;
 	};
 }
 
@@ -48,18 +142,51 @@ namespace EDW
 
 		static Display CreateAmd(int gpu, int output);
 		static Display CreateNvidia(Nvidia::NvPhysicalGpuHandle gpu, Nvidia::NvU32 output);
+		static Display CreateSimulated(const DisplayData &edid, const DisplayData &displayId = DisplayData(), int writeCycle = 0, bool writeProtected = false, int maxBusSpeed = 400, bool segmentSupported = true, int maxReadSize = 256, int droppedWrite = 0);
 
 		template <class T> bool GetId(T &id);
 		template <class T> bool GetName(T &name);
 		bool ReadEdid(DisplayData &displayData);
 		bool ReadDisplayId(DisplayData &displayData);
+		bool ReadRange(unsigned char address, int offset, int size, std::basic_string<unsigned char> &data);
+		bool Transfer(I2COperation *operations, int count);
+		bool GetEdid(DisplayData &displayData) const;
+		bool GetDisplayId(DisplayData &displayData) const;
 		bool WriteEdid(const DisplayData &displayData, bool fast = true);
+		bool WriteEdid(const DisplayData &displayData, const WritePlan &plan);
 		bool WriteDisplayId(const DisplayData &displayData, bool fast = true);
+		bool WriteDisplayId(const DisplayData &displayData, const WritePlan &plan);
+		int GetPageSize() const;
+		bool SetPageSize(int pageSize);
+		WriteVerification GetWriteVerification() const;
+		bool SetWriteVerification(WriteVerification verification);
+		bool GetAckPolling() const;
+		bool SetAckPolling(bool ackPolling);
+		WriteError GetWriteError() const;
+		bool SetJournal(const std::wstring &file);
+		bool GetBusIdentity(std::string &identity);
+		int GetBusSpeed() const;
+		bool SetBusSpeed(int speed);
+		bool NegotiateBusSpeed();
+		bool GetBusStatistics(BusStatistics &statistics) const;
+		BusError GetBusError() const;
+		bool GetRetryPolicy(RetryPolicy &policy) const;
+		bool SetRetryPolicy(const RetryPolicy &policy);
+		bool GetRetryStatistics(RetryStatistics &statistics) const;
+		bool GetTransactions(std::vector<I2CTransaction> &transactions) const;
+		bool ClearTransactions();
+
+		static bool CreateWritePlan(const DisplayData &oldDisplayData, const DisplayData &newDisplayData, int pageSize, WritePlan &plan);
 
 		////////////////////////////////////////////////////////////////////
 
 	private:
-		std::unique_ptr<struct DisplayImpl> impl;
+		friend class Provisioner;
+		friend struct ProvisionerImpl;
+
+		bool Detach();
+
+		std::shared_ptr<struct DisplayImpl> impl;
 	};
 }
 
@@ -10,60 +10,64 @@ namespace EDW
 	{
 		// Constants ///////////////////////////////////////////////////////
 
-		static const int MaxSize = 256;
+		static const int MaxSize = DisplayData::MaxSize;
 		static const int MaxLoadSize = MaxSize + 1;
+		static const int MaxTextSize = MaxSize * 16;
+		static const int SniffSize = 64;
+		static const int MaxLines = MaxSize / DisplayData::LineSize;
+
+		// Enums ///////////////////////////////////////////////////////////
+
+		enum Format
+		{
+			BinFormat,
+			DatFormat,
+			TxtFormat
+		};
 
 		// Functions ///////////////////////////////////////////////////////
 
-		DisplayDataImpl() = default;
-		DisplayDataImpl(const std::basic_string<unsigned char> &data);
+		DisplayDataImpl();
+		DisplayDataImpl(const DisplayDataImpl &other);
+		DisplayDataImpl(const DisplayDataView &view);
 
-		static std::unique_ptr<DisplayDataImpl> Create();
-		static std::unique_ptr<DisplayDataImpl> Create(const std::basic_string<unsigned char> &data);
-		std::unique_ptr<DisplayDataImpl> Clone() const;
+		static std::shared_ptr<DisplayDataImpl> Create();
+		static std::shared_ptr<DisplayDataImpl> Create(const DisplayDataView &view);
+		std::shared_ptr<DisplayDataImpl> Clone() const;
+		static unsigned long long CreateOrigin();
 
+		DisplayDataView GetView() const;
+		bool Update();
+		bool Update(int offset, int size);
 		bool GetData(std::basic_string<unsigned char> &data) const;
 		int GetSize() const;
 		int GetOriginalSize() const;
-		int GetReportedSize() const;
-		int GetDisplayIdBlockSize(int block) const;
-		bool Trim();
-		template <class T> bool GetId(T &id) const;
-		template <class T> bool GetEdidId(T &id) const;
-		template <class T> bool GetDisplayIdId(T &id, unsigned char tag) const;
-		template <class T> bool GetName(T &name) const;
-		template <class T> bool GetEdidName(T &name, unsigned char tag) const;
-		template <class T> bool GetDisplayIdName(T &id, unsigned char tag) const;
-		template <class T> bool GetText(T &text, int columns = 0) const;
+		bool Assign(const unsigned char *data, int size);
+		bool SetByte(int offset, unsigned char value);
+		bool SetRange(int offset, const unsigned char *data, int size);
+		bool MarkDirty(int offset, int size);
 		template <class T> bool Load(const T &name);
-		bool LoadBin(std::ifstream &stream);
-		bool LoadDat(std::ifstream &stream);
-		bool LoadTxt(std::ifstream &stream);
+		static Format GetFormat(const char *text, std::size_t size);
+		bool LoadBin(const char *text, std::size_t size);
+		bool LoadDat(const char *text, std::size_t size);
+		bool LoadTxt(const char *text, std::size_t size);
 		template <class T> bool SaveBin(const T &name) const;
 		template <class T> bool SaveDat(const T &name) const;
 		template <class T> bool SaveTxt(const T &name, int columns = 16) const;
-		bool IsEdid() const;
-		bool IsValidEdidHeader() const;
-		bool IsCorruptedEdidHeader() const;
 		bool FixEdidHeader();
-		bool IsValidEdidExtensionBlock(int block) const;
-		bool IsValidEdidExtensionBlocks() const;
 		bool FixEdidExtensionBlocks();
-		bool IsValidEdidChecksums() const;
 		bool FixEdidChecksums();
-		bool IsDisplayId() const;
-		bool IsValidDisplayIdChecksums() const;
 		bool FixDisplayIdChecksums();
-		bool IsValidChecksum(int offset, int size, unsigned char add = 0) const;
 		bool FixChecksum(int offset, int size);
 
-		static int FromHex(int value);
-		static int ToHex(int value);
-
 		// Variables ///////////////////////////////////////////////////////
 
-		std::basic_string<unsigned char> data;
+		unsigned char data[MaxSize];
+		int dataSize;
 		int originalSize;
+		DisplayDataCache cache;
+		std::bitset<MaxLines> dirtyLines;
+		unsigned long long origin;
 
 		////////////////////////////////////////////////////////////////////
 	};
@@ -79,22 +83,50 @@ EDW::DisplayData::DisplayData() :
 ////////////////////////////////////////////////////////////////////////////
 
 EDW::DisplayData::DisplayData(const std::basic_string<unsigned char> &data) :
-	impl(DisplayDataImpl::Create(data))
+	impl(DisplayDataImpl::Create(DisplayDataView(data)))
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::DisplayData::DisplayData(const DisplayDataView &view) :
+	impl(DisplayDataImpl::Create(view))
 {
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
 EDW::DisplayData::DisplayData(const DisplayData &other) :
-	impl(other.impl ? other.impl->Clone() : nullptr)
+	impl(other.impl)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::DisplayData::DisplayData(DisplayData &&other) noexcept :
+	impl(std::move(other.impl))
 {
+	other.impl = DisplayDataImpl::Create();
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
 EDW::DisplayData &EDW::DisplayData::operator=(const DisplayData &other)
 {
-	impl = other.impl ? other.impl->Clone() : nullptr;
+	impl = other.impl;
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::DisplayData &EDW::DisplayData::operator=(DisplayData &&other) noexcept
+{
+	if (this != &other)
+	{
+		impl = std::move(other.impl);
+		other.impl = DisplayDataImpl::Create();
+	}
+
 	return *this;
 }
 
@@ -113,8 +145,11 @@ EDW::DisplayData::operator bool() const
 
 bool EDW::DisplayData::operator==(const DisplayData &other) const
 {
+	if (impl == other.impl)
+		return true;
+
 	int size = std::min(impl->GetSize(), other.impl->GetSize());
-	return impl->data.compare(0, size, other.impl->data, 0, size) == 0;
+	return Kernels::IsEqual(impl->data, other.impl->data, size);
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -126,6 +161,73 @@ bool EDW::DisplayData::operator!=(const DisplayData &other) const
 
 ////////////////////////////////////////////////////////////////////////////
 
+EDW::DisplayDataView EDW::DisplayData::GetView() const
+{
+	return impl->GetView();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayData::GetEdidInfo(EdidInfo &info) const
+{
+	return impl->GetView().GetEdidInfo(info);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayData::GetDisplayIdIndex(DisplayIdIndex &index) const
+{
+	return impl->GetView().GetDisplayIdIndex(index);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayData::GetCtaInfo(int block, CtaInfo &info) const
+{
+	return impl->GetView().GetCtaInfo(block, info);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayData::GetDetailedTimings(std::vector<DetailedTiming> &timings) const
+{
+	return impl->GetView().GetDetailedTimings(timings);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayData::GetModeTable(const std::vector<DisplayData> &displayData, ModeTable &table)
+{
+	table.Timings.clear();
+	table.Offsets.clear();
+	std::size_t count = 0;
+
+	for (const DisplayData &item : displayData)
+		count += item.impl->cache.Timings.size();
+
+	table.Timings.reserve(count);
+	table.Offsets.reserve(displayData.size() + 1);
+
+	for (const DisplayData &item : displayData)
+	{
+		const std::vector<DetailedTiming> &timings = item.impl->cache.Timings;
+		table.Offsets.push_back(static_cast<int>(table.Timings.size()));
+		table.Timings.insert(table.Timings.end(), timings.begin(), timings.end());
+	}
+
+	table.Offsets.push_back(static_cast<int>(table.Timings.size()));
+	return !table.Timings.empty();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayData::HasVic(int vic) const
+{
+	return impl->GetView().HasVic(vic);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
 bool EDW::DisplayData::GetData(std::basic_string<unsigned char> &data) const
 {
 	return impl->GetData(data);
@@ -149,7 +251,7 @@ int EDW::DisplayData::GetOriginalSize() const
 
 int EDW::DisplayData::GetReportedSize() const
 {
-	return impl->GetReportedSize();
+	return impl->GetView().GetReportedSize();
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -157,7 +259,7 @@ int EDW::DisplayData::GetReportedSize() const
 template <class T>
 bool EDW::DisplayData::GetId(T &id) const
 {
-	return impl->GetId(id);
+	return impl->GetView().GetId(id);
 }
 
 template bool EDW::DisplayData::GetId(std::string &id) const;
@@ -168,7 +270,7 @@ template bool EDW::DisplayData::GetId(std::wstring &id) const;
 template <class T>
 bool EDW::DisplayData::GetName(T &name) const
 {
-	return impl->GetName(name);
+	return impl->GetView().GetName(name);
 }
 
 template bool EDW::DisplayData::GetName(std::string &name) const;
@@ -179,7 +281,7 @@ template bool EDW::DisplayData::GetName(std::wstring &name) const;
 template <class T>
 bool EDW::DisplayData::GetText(T &text, int columns) const
 {
-	return impl->GetText(text, columns);
+	return impl->GetView().GetText(text, columns);
 }
 
 template bool EDW::DisplayData::GetText(std::string &text, int columns) const;
@@ -187,9 +289,21 @@ template bool EDW::DisplayData::GetText(std::wstring &text, int columns) const;
 
 ////////////////////////////////////////////////////////////////////////////
 
+template <class T>
+bool EDW::DisplayData::GetFieldText(T &text) const
+{
+	return impl->GetView().GetFieldText(text);
+}
+
+template bool EDW::DisplayData::GetFieldText(std::string &text) const;
+template bool EDW::DisplayData::GetFieldText(std::wstring &text) const;
+
+////////////////////////////////////////////////////////////////////////////
+
 template <class T>
 bool EDW::DisplayData::Load(const T &file)
 {
+	Detach();
 	return impl->Load(file);
 }
 
@@ -233,618 +347,463 @@ template bool EDW::DisplayData::SaveTxt(const std::wstring &file, int columns) c
 
 bool EDW::DisplayData::IsEdid() const
 {
-	return impl->IsEdid();
+	return impl->GetView().IsEdid();
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
 bool EDW::DisplayData::IsValidEdidHeader() const
 {
-	return impl->IsValidEdidHeader();
+	return impl->GetView().IsValidEdidHeader();
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayData::FixEdidHeader()
+bool EDW::DisplayData::IsValidEdidFields() const
 {
-	return impl->FixEdidHeader();
+	return impl->GetView().IsValidEdidFields();
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayData::IsValidEdidExtensionBlocks() const
+bool EDW::DisplayData::SetByte(int offset, unsigned char value)
 {
-	return impl->IsValidEdidExtensionBlocks();
+	Detach();
+	bool status = impl->SetByte(offset, value);
+	impl->Update(offset, 1);
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayData::FixEdidExtensionBlocks()
+bool EDW::DisplayData::SetRange(int offset, const unsigned char *data, int size)
 {
-	return impl->FixEdidExtensionBlocks();
+	Detach();
+	bool status = impl->SetRange(offset, data, size);
+	impl->Update(offset, size);
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayData::IsValidEdidChecksums() const
+bool EDW::DisplayData::IsDirtyLine(int line) const
 {
-	return impl->IsValidEdidChecksums();
+	if (line < 0 || line >= DisplayDataImpl::MaxLines)
+		return false;
+
+	return impl->dirtyLines.test(line);
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayData::FixEdidChecksums()
+bool EDW::DisplayData::IsSameOrigin(const DisplayData &other) const
 {
-	return impl->FixEdidChecksums();
+	return impl->origin != 0 && impl->origin == other.impl->origin;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayData::IsDisplayId() const
+bool EDW::DisplayData::FixEdidHeader()
 {
-	return impl->IsDisplayId();
+	Detach();
+	bool status = impl->FixEdidHeader();
+	impl->Update();
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayData::IsValidDisplayIdChecksums() const
+bool EDW::DisplayData::IsValidEdidExtensionBlocks() const
 {
-	return impl->IsValidDisplayIdChecksums();
+	return impl->GetView().IsValidEdidExtensionBlocks();
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayData::FixDisplayIdChecksums()
+bool EDW::DisplayData::FixEdidExtensionBlocks()
 {
-	return impl->FixDisplayIdChecksums();
+	Detach();
+	bool status = impl->FixEdidExtensionBlocks();
+	impl->Update();
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-EDW::DisplayDataImpl::DisplayDataImpl(const std::basic_string<unsigned char> &data) :
-	data(data)
+bool EDW::DisplayData::IsValidEdidChecksums() const
 {
-	Trim();
+	return impl->GetView().IsValidEdidChecksums();
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-std::unique_ptr<EDW::DisplayDataImpl> EDW::DisplayDataImpl::Create()
+bool EDW::DisplayData::FixEdidChecksums()
 {
-	std::unique_ptr<DisplayDataImpl> impl(new DisplayDataImpl);
-	return impl;
+	Detach();
+	bool status = impl->FixEdidChecksums();
+	impl->Update();
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-std::unique_ptr<EDW::DisplayDataImpl> EDW::DisplayDataImpl::Create(const std::basic_string<unsigned char> &data)
+bool EDW::DisplayData::IsDisplayId() const
 {
-	std::unique_ptr<DisplayDataImpl> impl(new DisplayDataImpl(data));
-	return impl;
+	return impl->GetView().IsDisplayId();
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-std::unique_ptr<EDW::DisplayDataImpl> EDW::DisplayDataImpl::Clone() const
+bool EDW::DisplayData::IsValidDisplayIdChecksums() const
 {
-	std::unique_ptr<DisplayDataImpl> impl(new DisplayDataImpl(*this));
-	return impl;
+	return impl->GetView().IsValidDisplayIdChecksums();
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayDataImpl::GetData(std::basic_string<unsigned char> &data) const
+bool EDW::DisplayData::FixDisplayIdChecksums()
 {
-	data = this->data;
-	return true;
+	Detach();
+	bool status = impl->FixDisplayIdChecksums();
+	impl->Update();
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-int EDW::DisplayDataImpl::GetSize() const
+bool EDW::DisplayData::Detach()
 {
-	return static_cast<int>(data.size());
+	if (impl.use_count() > 1)
+		impl = impl->Clone();
+
+	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-int EDW::DisplayDataImpl::GetOriginalSize() const
+EDW::DisplayDataImpl::DisplayDataImpl() :
+	dataSize(0),
+	originalSize(0),
+	cache(),
+	dirtyLines(),
+	origin(0)
 {
-	return originalSize;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-int EDW::DisplayDataImpl::GetReportedSize() const
+EDW::DisplayDataImpl::DisplayDataImpl(const DisplayDataImpl &other) :
+	dataSize(other.dataSize),
+	originalSize(other.originalSize),
+	cache(other.cache),
+	dirtyLines(other.dirtyLines),
+	origin(other.origin)
 {
-	if (IsEdid())
-		return data[126] * 128 + 128;
-
-	if (IsDisplayId())
-	{
-		int lastBlockSize = GetDisplayIdBlockSize(data[3]);
-
-		if (lastBlockSize < 5)
-			lastBlockSize = 256;
-
-		return data[3] * 256 + lastBlockSize;
-	}
-
-	return GetSize();
+	std::memcpy(data, other.data, dataSize);
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-int EDW::DisplayDataImpl::GetDisplayIdBlockSize(int block) const
+EDW::DisplayDataImpl::DisplayDataImpl(const DisplayDataView &view)
 {
-	if (block < 0)
-		return 0;
-
-	int offset = block * 256;
-	int end = offset + 5;
-
-	if (GetSize() < end)
-		return 0;
+	Assign(view.GetData(), view.GetSize());
+}
 
-	if (data[offset] < 0x10)
-		return 0;
+////////////////////////////////////////////////////////////////////////////
 
-	int index = offset + 1;
-	int size = data[index] + 5;
+std::shared_ptr<EDW::DisplayDataImpl> EDW::DisplayDataImpl::Create()
+{
+	static const std::shared_ptr<DisplayDataImpl> impl = std::make_shared<DisplayDataImpl>();
+	return impl;
+}
 
-	if (size > 256)
-		return 0;
+////////////////////////////////////////////////////////////////////////////
 
-	end = offset + size;
+std::shared_ptr<EDW::DisplayDataImpl> EDW::DisplayDataImpl::Create(const DisplayDataView &view)
+{
+	std::shared_ptr<DisplayDataImpl> impl = std::make_shared<DisplayDataImpl>(view);
+	return impl;
+}
 
-	if (GetSize() < end)
-		return 0;
+////////////////////////////////////////////////////////////////////////////
 
-	return size;
+std::shared_ptr<EDW::DisplayDataImpl> EDW::DisplayDataImpl::Clone() const
+{
+	std::shared_ptr<DisplayDataImpl> impl = std::make_shared<DisplayDataImpl>(*this);
+	return impl;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayDataImpl::Trim()
+unsigned long long EDW::DisplayDataImpl::CreateOrigin()
 {
-	int size = GetReportedSize();
+	static std::atomic<unsigned long long> origin(0);
+	return ++origin;
+}
 
-	if (GetSize() > size)
-		data.resize(size);
+////////////////////////////////////////////////////////////////////////////
 
-	originalSize = GetSize();
+EDW::DisplayDataView EDW::DisplayDataImpl::GetView() const
+{
+	return DisplayDataView(data, dataSize, &cache);
+}
 
-	if (GetSize() > MaxSize)
-		data.resize(MaxSize);
+////////////////////////////////////////////////////////////////////////////
 
+bool EDW::DisplayDataImpl::Update()
+{
+	DisplayDataView(data, dataSize).Decode(cache);
 	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-template <class T>
-bool EDW::DisplayDataImpl::GetId(T &id) const
+bool EDW::DisplayDataImpl::Update(int offset, int size)
 {
-	if (IsEdid())
-	{
-		if (GetEdidId(id))
-			return true;
-	}
-	else if (IsDisplayId())
-	{
-		if (data[0] < 0x20)
-		{
-			if (GetDisplayIdId(id, 0x00))
-				return true;
-
-			if (GetDisplayIdId(id, 0x20))
-				return true;
-		}
-		else
-		{
-			if (GetDisplayIdId(id, 0x20))
-				return true;
-
-			if (GetDisplayIdId(id, 0x00))
-				return true;
-		}
-	}
-
-	return false;
+	return DisplayDataView(data, dataSize).Decode(cache, offset, size);
 }
 
-template bool EDW::DisplayDataImpl::GetId(std::string &id) const;
-template bool EDW::DisplayDataImpl::GetId(std::wstring &id) const;
-
 ////////////////////////////////////////////////////////////////////////////
 
-template <class T>
-bool EDW::DisplayDataImpl::GetEdidId(T &id) const
+bool EDW::DisplayDataImpl::GetData(std::basic_string<unsigned char> &data) const
 {
-	if (GetSize() < 128)
-		return false;
-
-	id.clear();
-	id.push_back(64 | (data[8] >> 2 & 31));
-	id.push_back(64 | (data[8] << 3 & 24) | (data[9] >> 5 & 7));
-	id.push_back(64 | (data[9] & 31));
-	id.push_back(ToHex(data[11] >> 4));
-	id.push_back(ToHex(data[11] & 15));
-	id.push_back(ToHex(data[10] >> 4));
-	id.push_back(ToHex(data[10] & 15));
+	data.assign(this->data, dataSize);
 	return true;
 }
 
-template bool EDW::DisplayDataImpl::GetEdidId(std::string &id) const;
-template bool EDW::DisplayDataImpl::GetEdidId(std::wstring &id) const;
-
 ////////////////////////////////////////////////////////////////////////////
 
-template <class T>
-bool EDW::DisplayDataImpl::GetDisplayIdId(T &id, unsigned char tag) const
+int EDW::DisplayDataImpl::GetSize() const
 {
-	int end = GetDisplayIdBlockSize(0) - 1;
-
-	for (int index = 6; index < end; index += data[index] + 3)
-	{
-		int offset = index - 2;
-		const unsigned char *byte = &data[offset];
-
-		if (byte[0] == tag && byte[2] >= 5)
-		{
-			id.clear();
-
-			if (tag == 0x00 && std::isgraph(byte[3]) && std::isgraph(byte[4]) && std::isgraph(byte[5]))
-			{
-				id.push_back(byte[3]);
-				id.push_back(byte[4]);
-				id.push_back(byte[5]);
-			}
-			else
-			{
-				id.push_back(ToHex(byte[3] >> 4));
-				id.push_back(ToHex(byte[3] & 15));
-				id.push_back(ToHex(byte[4] >> 4));
-				id.push_back(ToHex(byte[4] & 15));
-				id.push_back(ToHex(byte[5] >> 4));
-				id.push_back(ToHex(byte[5] & 15));
-			}
-
-			id.push_back(ToHex(byte[7] >> 4));
-			id.push_back(ToHex(byte[7] & 15));
-			id.push_back(ToHex(byte[6] >> 4));
-			id.push_back(ToHex(byte[6] & 15));
-			return true;
-		}
-	}
-
-	return false;
+	return dataSize;
 }
 
-template bool EDW::DisplayDataImpl::GetDisplayIdId(std::string &id, unsigned char tag) const;
-template bool EDW::DisplayDataImpl::GetDisplayIdId(std::wstring &id, unsigned char tag) const;
-
 ////////////////////////////////////////////////////////////////////////////
 
-template <class T>
-bool EDW::DisplayDataImpl::GetName(T &name) const
+int EDW::DisplayDataImpl::GetOriginalSize() const
 {
-	if (IsEdid())
-	{
-		if (GetEdidName(name, 0xFC))
-			return true;
-
-		if (GetEdidName(name, 0xFE))
-			return true;
-	}
-	else if (IsDisplayId())
-	{
-		if (data[0] < 0x20)
-		{
-			if (GetDisplayIdName(name, 0x00))
-				return true;
-
-			if (GetDisplayIdName(name, 0x20))
-				return true;
-		}
-		else
-		{
-			if (GetDisplayIdName(name, 0x20))
-				return true;
-
-			if (GetDisplayIdName(name, 0x00))
-				return true;
-		}
-	}
-
-	return false;
+	return originalSize;
 }
 
-template bool EDW::DisplayDataImpl::GetName(std::string &name) const;
-template bool EDW::DisplayDataImpl::GetName(std::wstring &name) const;
-
 ////////////////////////////////////////////////////////////////////////////
 
-template <class T>
-bool EDW::DisplayDataImpl::GetEdidName(T &name, unsigned char tag) const
+bool EDW::DisplayDataImpl::Assign(const unsigned char *data, int size)
 {
-	if (GetSize() < 128)
-		return false;
-
-	for (int slot = 0; slot < 4; ++slot)
-	{
-		int offset = 54 + slot * 18;
-		const unsigned char *byte = &data[offset];
-
-		if (byte[0] == 0x00 && byte[1] == 0x00 && byte[2] == 0x00 && byte[3] == tag && byte[4] == 0x00)
-		{
-			name.clear();
-			int size = 13;
-			int begin = 5;
-			int end = begin + size;
+	DisplayDataView view(data, std::max(size, 0));
+	originalSize = std::min(view.GetSize(), view.GetReportedSize());
+	dataSize = originalSize;
 
-			for (int index = begin; index < end && byte[index] != 0x0A && byte[index] != 0x00; ++index)
-				name.push_back(byte[index]);
+	if (dataSize > MaxSize)
+		dataSize = MaxSize;
 
-			return true;
-		}
-	}
-
-	return false;
+	std::memcpy(this->data, data, dataSize);
+	dirtyLines.reset();
+	origin = CreateOrigin();
+	return Update();
 }
 
-template bool EDW::DisplayDataImpl::GetEdidName(std::string &name, unsigned char tag) const;
-template bool EDW::DisplayDataImpl::GetEdidName(std::wstring &name, unsigned char tag) const;
-
 ////////////////////////////////////////////////////////////////////////////
 
-template <class T>
-bool EDW::DisplayDataImpl::GetDisplayIdName(T &name, unsigned char tag) const
+bool EDW::DisplayDataImpl::SetByte(int offset, unsigned char value)
 {
-	int end = GetDisplayIdBlockSize(0) - 1;
-
-	for (int index = 6; index < end; index += data[index] + 3)
-	{
-		int offset = index - 2;
-		const unsigned char *byte = &data[offset];
-
-		if (byte[0] == tag && byte[2] >= 12)
-		{
-			name.clear();
-			int size = std::min<int>(byte[14], byte[2] - 12);
-			int begin = 15;
-			int end = begin + size;
-
-			for (int index = begin; index < end; ++index)
-				name.push_back(byte[index]);
-
-			return true;
-		}
-	}
+	if (offset < 0 || offset >= dataSize)
+		return false;
 
-	return false;
-}
+	unsigned char oldValue = data[offset];
 
-template bool EDW::DisplayDataImpl::GetDisplayIdName(std::string &name, unsigned char tag) const;
-template bool EDW::DisplayDataImpl::GetDisplayIdName(std::wstring &name, unsigned char tag) const;
+	if (oldValue == value)
+		return true;
 
-////////////////////////////////////////////////////////////////////////////
+	DisplayDataView view = GetView();
+	int checksum = view.GetChecksumOffset(offset);
+	bool displayId = view.IsDisplayId();
+	data[offset] = value;
+	MarkDirty(offset, 1);
 
-template <class T>
-bool EDW::DisplayDataImpl::GetText(T &text, int columns) const
-{
-	text.clear();
+	if (checksum < 0 || checksum == offset)
+		return true;
 
-	for (int index = 0; index < GetSize(); ++index)
+	if (displayId && offset % 256 < 2)
 	{
-		if (index > 0)
-		{
-			if (columns > 0 && index % columns == 0)
-			{
-				text.push_back('\r');
-				text.push_back('\n');
-			}
-			else
-			{
-				text.push_back(' ');
-			}
-		}
-
-		text.push_back(ToHex(data[index] >> 4));
-		text.push_back(ToHex(data[index] & 15));
+		int section = offset / 256;
+		int size = view.GetDisplayIdBlockSize(section);
+		MarkDirty(section * 256 + size - 1, 1);
+		return size < 5 || FixChecksum(section * 256, size);
 	}
 
+	data[checksum] -= value - oldValue;
+	MarkDirty(checksum, 1);
 	return true;
 }
 
-template bool EDW::DisplayDataImpl::GetText(std::string &text, int columns) const;
-template bool EDW::DisplayDataImpl::GetText(std::wstring &text, int columns) const;
-
 ////////////////////////////////////////////////////////////////////////////
 
-template <class T>
-bool EDW::DisplayDataImpl::Load(const T &file)
+bool EDW::DisplayDataImpl::SetRange(int offset, const unsigned char *data, int size)
 {
-	std::ifstream stream(file, std::ios::binary);
-
-	if (!stream)
+	if (offset < 0 || size < 0 || offset + size > dataSize)
 		return false;
 
-	if (!LoadTxt(stream))
-	if (!LoadDat(stream))
-	if (!LoadBin(stream))
+	for (int index = 0; index < size; ++index)
 	{
-		stream.close();
-		return false;
+		if (!SetByte(offset + index, data[index]))
+			return false;
 	}
 
-	stream.close();
-	Trim();
 	return true;
 }
 
-template bool EDW::DisplayDataImpl::Load(const std::string &file);
-template bool EDW::DisplayDataImpl::Load(const std::wstring &file);
-
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayDataImpl::LoadBin(std::ifstream &stream)
+bool EDW::DisplayDataImpl::MarkDirty(int offset, int size)
 {
-	stream.clear();
-	stream.seekg(0);
-
-	if (!stream)
+	if (offset < 0 || size < 1)
 		return false;
 
-	std::vector<unsigned char> buffer(MaxLoadSize);
-	stream.read(reinterpret_cast<char *>(buffer.data()), buffer.size());
+	int end = std::min((offset + size - 1) / DisplayData::LineSize, MaxLines - 1);
 
-	if (!stream && !stream.eof())
-		return false;
+	for (int line = offset / DisplayData::LineSize; line <= end; ++line)
+		dirtyLines.set(line);
 
-	data.assign(buffer.data(), static_cast<int>(stream.gcount()));
 	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayDataImpl::LoadDat(std::ifstream &stream)
+template <class T>
+bool EDW::DisplayDataImpl::Load(const T &file)
 {
-	stream.clear();
-	stream.seekg(0);
+	std::ifstream stream(file, std::ios::binary | std::ios::ate);
 
 	if (!stream)
 		return false;
 
-	std::string type;
-	stream >> type;
+	std::streamoff size = stream.tellg();
+	stream.seekg(0);
 
-	if (!stream)
+	if (!stream || size < 0)
 		return false;
 
-	std::transform(type.begin(), type.end(), type.begin(), toupper);
+	std::string text(static_cast<std::size_t>(std::min<std::streamoff>(size, SniffSize)), '\0');
+	stream.read(&text[0], text.size());
 
-	if (type != "EDID" && type != "DISPLAYID" && type != "DATA")
+	if (stream.gcount() != static_cast<std::streamsize>(text.size()))
 		return false;
 
-	stream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-	stream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-	stream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+	Format format = size > MaxTextSize ? BinFormat : GetFormat(text.data(), text.size());
+	std::streamoff loadSize = format == BinFormat ? std::min<std::streamoff>(size, MaxLoadSize) : size;
 
-	if (!stream)
-		return false;
+	if (loadSize > static_cast<std::streamoff>(text.size()))
+	{
+		std::size_t offset = text.size();
+		text.resize(static_cast<std::size_t>(loadSize));
+		stream.read(&text[offset], loadSize - offset);
 
-	std::vector<unsigned char> buffer;
+		if (stream.gcount() != static_cast<std::streamsize>(loadSize - offset))
+			return false;
+	}
 
-	for (int index = 0; index < MaxLoadSize; ++index)
-	{
-		if (index % 16 == 0)
-		{
-			int offset;
-			stream >> std::hex >> offset >> std::dec;
+	stream.close();
 
-			if (!stream)
-				break;
+	if (format == DatFormat && LoadDat(text.data(), text.size()))
+		return true;
 
-			if (offset != index)
-				return false;
+	if (format == TxtFormat && LoadTxt(text.data(), text.size()))
+		return true;
 
-			stream >> std::ws;
-			int delimiter = stream.get();
+	return LoadBin(text.data(), text.size());
+}
 
-			if (!stream)
-				return false;
+template bool EDW::DisplayDataImpl::Load(const std::string &file);
+template bool EDW::DisplayDataImpl::Load(const std::wstring &file);
 
-			if (delimiter != '|')
-				return false;
-		}
+////////////////////////////////////////////////////////////////////////////
+
+EDW::DisplayDataImpl::Format EDW::DisplayDataImpl::GetFormat(const char *text, std::size_t size)
+{
+	const char *end = text + size;
+	const char *begin = text;
 
-		stream >> std::ws;
-		int hex1 = stream.get();
+	while (begin < end && Hex::IsSpace(static_cast<unsigned char>(*begin)))
+		++begin;
 
-		if (!stream)
-		{
-			if (index % 16 == 0)
-				return false;
+	const char *token = begin;
 
-			break;
-		}
+	while (token < end && !Hex::IsSpace(static_cast<unsigned char>(*token)))
+		++token;
 
-		int hex2 = stream.get();
+	std::string type(begin, token);
+	std::transform(type.begin(), type.end(), type.begin(), toupper);
 
-		if (!stream)
-			return false;
+	if (type == "EDID" || type == "DISPLAYID" || type == "DATA")
+		return DatFormat;
 
-		if (!std::isxdigit(hex1) || !std::isxdigit(hex2))
-			return false;
+	std::size_t sniffSize = std::min<std::size_t>(size, SniffSize);
+
+	for (std::size_t index = 0; index < sniffSize; ++index)
+	{
+		unsigned char value = text[index];
 
-		buffer.push_back(FromHex(hex1) << 4 | FromHex(hex2));
+		if ((value < 0x20 || value > 0x7E) && !Hex::IsSpace(value))
+			return BinFormat;
 	}
 
-	if (!stream && !stream.eof())
-		return false;
+	return TxtFormat;
+}
 
-	if (buffer.empty())
-		return false;
+////////////////////////////////////////////////////////////////////////////
 
-	data.assign(buffer.data(), buffer.size());
+bool EDW::DisplayDataImpl::LoadBin(const char *text, std::size_t size)
+{
+	Assign(reinterpret_cast<const unsigned char *>(text), static_cast<int>(std::min<std::size_t>(size, MaxLoadSize)));
 	return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayDataImpl::LoadTxt(std::ifstream &stream)
+bool EDW::DisplayDataImpl::LoadDat(const char *text, std::size_t size)
 {
-	stream.clear();
-	stream.seekg(0);
+	const char *end = text + size;
 
-	if (!stream)
-		return false;
-
-	std::vector<unsigned char> buffer;
+	while (text < end && Hex::IsSpace(static_cast<unsigned char>(*text)))
+		++text;
 
-	for (int index = 0; index < MaxLoadSize; ++index)
-	{
-		stream >> std::ws;
-		int hex1 = stream.get();
+	std::string type;
 
-		if (!stream)
-			break;
+	while (text < end && !Hex::IsSpace(static_cast<unsigned char>(*text)))
+		type.push_back(*text++);
 
-		int hex2 = stream.get();
+	std::transform(type.begin(), type.end(), type.begin(), toupper);
 
-		if (!stream)
-			return false;
+	if (type != "EDID" && type != "DISPLAYID" && type != "DATA")
+		return false;
 
-		if (hex1 == '0' && (hex2 == 'x' || hex2 == 'X'))
-		{
-			hex1 = stream.get();
-			hex2 = stream.get();
+	for (int line = 0; line < 3 && text < end; ++line)
+	{
+		text = std::find(text, end, '\n');
 
-			if (!stream)
-				return false;
-		}
+		if (text < end)
+			++text;
+	}
 
-		if (!std::isxdigit(hex1) || !std::isxdigit(hex2))
-			return false;
+	std::vector<unsigned char> buffer;
 
-		buffer.push_back(FromHex(hex1) << 4 | FromHex(hex2));
-		int delimiter = stream.get();
+	if (!Hex::DecodeRows(buffer, text, end - text))
+		return false;
 
-		if (!stream)
-			break;
+	Assign(buffer.data(), static_cast<int>(buffer.size()));
+	return true;
+}
 
-		if (!std::ispunct(delimiter))
-			stream.unget();
-	}
+////////////////////////////////////////////////////////////////////////////
 
-	if (!stream && !stream.eof())
-		return false;
+bool EDW::DisplayDataImpl::LoadTxt(const char *text, std::size_t size)
+{
+	std::vector<unsigned char> buffer;
 
-	if (buffer.empty())
+	if (!Hex::Decode(buffer, text, size))
 		return false;
 
-	data.assign(buffer.data(), buffer.size());
+	Assign(buffer.data(), static_cast<int>(buffer.size()));
 	return true;
 }
 
@@ -858,7 +817,7 @@ bool EDW::DisplayDataImpl::SaveBin(const T &file) const
 	if (!stream)
 		return false;
 
-	stream.write(reinterpret_cast<const char *>(data.data()), data.size());
+	stream.write(reinterpret_cast<const char *>(data), dataSize);
 	stream.close();
 	return stream.good();
 }
@@ -876,57 +835,31 @@ bool EDW::DisplayDataImpl::SaveDat(const T &file) const
 	if (!stream)
 		return false;
 
-	if (IsEdid())
-		stream << "EDID BYTES:\r\n";
-	else if (IsDisplayId())
-		stream << "DISPLAYID BYTES:\r\n";
+	std::string text;
+
+	if (GetView().IsEdid())
+		text = "EDID BYTES:\r\n";
+	else if (GetView().IsDisplayId())
+		text = "DISPLAYID BYTES:\r\n";
 	else
-		stream << "DATA BYTES:\r\n";
+		text = "DATA BYTES:\r\n";
 
 	if (GetSize() <= 256)
 	{
-		stream << "0x   00 01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F\r\n";
-		stream << "    ------------------------------------------------\r\n";
+		text += "0x   00 01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F\r\n";
+		text += "    ------------------------------------------------\r\n";
 	}
 	else
 	{
-		stream << "0x     00 01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F\r\n";
-		stream << "      ------------------------------------------------\r\n";
-	}
-
-	int columns = 16;
-
-	for (int index = 0; index < GetSize(); ++index)
-	{
-		if (index % columns == 0)
-		{
-			if (index > 0)
-			{
-				stream.put('\r');
-				stream.put('\n');
-			}
-
-			if (GetSize() > 256)
-			{
-				stream.put(ToHex(index >> 12 & 15));
-				stream.put(ToHex(index >> 8 & 15));
-			}
-
-			stream.put(ToHex(index >> 4 & 15));
-			stream.put(ToHex(index & 15));
-			stream << " | ";
-		}
-		else
-		{
-			stream.put(' ');
-		}
-
-		stream.put(ToHex(data[index] >> 4));
-		stream.put(ToHex(data[index] & 15));
+		text += "0x     00 01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F\r\n";
+		text += "      ------------------------------------------------\r\n";
 	}
 
-	stream.put('\r');
-	stream.put('\n');
+	int offsetDigits = GetSize() > 256 ? 4 : 2;
+	std::size_t header = text.size();
+	text.resize(header + Hex::GetEncodedSize(GetSize(), 16, offsetDigits, true));
+	Hex::EncodeBuffer(&text[header], data, GetSize(), 16, offsetDigits, true);
+	stream.write(text.data(), text.size());
 	stream.close();
 	return stream.good();
 }
@@ -944,27 +877,9 @@ bool EDW::DisplayDataImpl::SaveTxt(const T &file, int columns) const
 	if (!stream)
 		return false;
 
-	for (int index = 0; index < GetSize(); ++index)
-	{
-		if (index > 0)
-		{
-			if (columns > 0 && index % columns == 0)
-			{
-				stream.put('\r');
-				stream.put('\n');
-			}
-			else
-			{
-				stream.put(' ');
-			}
-		}
-
-		stream.put(ToHex(data[index] >> 4));
-		stream.put(ToHex(data[index] & 15));
-	}
-
-	stream.put('\r');
-	stream.put('\n');
+	std::string text;
+	Hex::Encode(text, data, GetSize(), columns, 0, true);
+	stream.write(text.data(), text.size());
 	stream.close();
 	return stream.good();
 }
@@ -974,98 +889,13 @@ template bool EDW::DisplayDataImpl::SaveTxt(const std::wstring &file, int column
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayDataImpl::IsEdid() const
-{
-	if (GetSize() < 128)
-		return false;
-
-	if (!IsValidEdidHeader() && !IsCorruptedEdidHeader())
-		return false;
-
-	return true;
-}
-
-////////////////////////////////////////////////////////////////////////////
-
-bool EDW::DisplayDataImpl::IsValidEdidHeader() const
-{
-	if (GetSize() < 128)
-		return false;
-
-	if (data.compare(0, 8, {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00}) != 0)
-		return false;
-
-	return true;
-}
-
-////////////////////////////////////////////////////////////////////////////
-
-bool EDW::DisplayDataImpl::IsCorruptedEdidHeader() const
-{
-	if (GetSize() < 128)
-		return false;
-
-	if (data[18] != 1 || data[19] > 4)
-		return false;
-
-	return IsValidChecksum(8, 120, 6);
-}
-
-////////////////////////////////////////////////////////////////////////////
-
 bool EDW::DisplayDataImpl::FixEdidHeader()
 {
 	if (GetSize() < 128)
 		return false;
 
-	data.replace(0, 8, {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00});
-	return true;
-}
-
-////////////////////////////////////////////////////////////////////////////
-
-bool EDW::DisplayDataImpl::IsValidEdidExtensionBlock(int block) const
-{
-	if (block < 1)
-		return false;
-
-	int offset = block * 128;
-	int end = offset + 128;
-
-	if (GetSize() < end)
-		return false;
-
-	if (data.compare(offset, 8, {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00}) == 0)
-		return false;
-
-	std::basic_string<unsigned char> zero(127, 0x00);
-
-	if (data.compare(offset, 127, zero) == 0)
-		return false;
-
-	std::basic_string<unsigned char> compare(127, 0xFF);
-
-	if (data.compare(offset, 127, compare) == 0)
-		return false;
-
-	return true;
-}
-
-////////////////////////////////////////////////////////////////////////////
-
-bool EDW::DisplayDataImpl::IsValidEdidExtensionBlocks() const
-{
-	if (GetSize() < 128)
-		return false;
-
-	int blocks = std::min(data[126] + 1, (GetSize() + 127) / 128);
-
-	for (int block = 1; block < blocks; ++block)
-	{
-		if (!IsValidEdidExtensionBlock(block))
-			return false;
-	}
-
+	std::memcpy(data, DisplayDataView::EdidHeader, sizeof(DisplayDataView::EdidHeader));
+	MarkDirty(0, sizeof(DisplayDataView::EdidHeader));
 	return true;
 }
 
@@ -1076,43 +906,27 @@ bool EDW::DisplayDataImpl::FixEdidExtensionBlocks()
 	if (GetSize() < 128)
 		return false;
 
-	int blocks = std::min(data[126] + 1, (GetSize() + 127) / 128);
+	int blocks = std::min<int>(EdidSchema::ExtensionCount::Get(data) + 1, (GetSize() + 127) / 128);
 
 	for (int block = blocks - 1; block >= 1; --block)
 	{
-		if (!IsValidEdidExtensionBlock(block))
+		if (!GetView().IsValidEdidExtensionBlock(block))
 		{
 			int offset = block * 128;
-			data.erase(offset, 128);
+			int size = std::min(128, dataSize - offset);
+			std::memmove(data + offset, data + offset + size, dataSize - offset - size);
+			MarkDirty(offset, dataSize - offset);
+			dataSize -= size;
 		}
 	}
 
-	data[126] = GetSize() / 128 - 1;
-	return FixChecksum(0, 128);
-}
-
-////////////////////////////////////////////////////////////////////////////
-
-bool EDW::DisplayDataImpl::IsValidEdidChecksums() const
-{
-	if (GetSize() < 128)
-		return false;
-
-	if (!IsValidChecksum(0, 128))
-		return false;
-
-	int blocks = std::min(data[126] + 1, GetSize() / 128);
-
-	for (int block = 1; block < blocks; ++block)
+	if (EdidSchema::ExtensionCount::Get(data) != static_cast<unsigned>(GetSize() / 128 - 1))
 	{
-		if (!IsValidEdidExtensionBlock(block))
-			continue;
-
-		if (!IsValidChecksum(block * 128, 128))
-			return false;
+		EdidSchema::ExtensionCount::Set(data, GetSize() / 128 - 1);
+		MarkDirty(EdidSchema::ExtensionCount::Offset, EdidSchema::ExtensionCount::Size);
 	}
 
-	return true;
+	return FixChecksum(0, 128);
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -1125,11 +939,11 @@ bool EDW::DisplayDataImpl::FixEdidChecksums()
 	if (!FixChecksum(0, 128))
 		return false;
 
-	int blocks = std::min(data[126] + 1, GetSize() / 128);
+	int blocks = std::min<int>(EdidSchema::ExtensionCount::Get(data) + 1, GetSize() / 128);
 
 	for (int block = 1; block < blocks; ++block)
 	{
-		if (!IsValidEdidExtensionBlock(block))
+		if (!GetView().IsValidEdidExtensionBlock(block))
 			continue;
 
 		if (!FixChecksum(block * 128, 128))
@@ -1141,50 +955,6 @@ bool EDW::DisplayDataImpl::FixEdidChecksums()
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayDataImpl::IsDisplayId() const
-{
-	int size = GetDisplayIdBlockSize(0);
-
-	if (size < 5)
-		return false;
-
-	int end = size - 1;
-	int bytes = 5;
-
-	for (int index = 6; index < end; index += data[index] + 3)
-		bytes += data[index] + 3;
-
-	if (bytes > size)
-		return false;
-
-	return true;
-}
-
-////////////////////////////////////////////////////////////////////////////
-
-bool EDW::DisplayDataImpl::IsValidDisplayIdChecksums() const
-{
-	if (GetSize() < 5)
-		return false;
-
-	int blocks = std::min(data[3] + 1, (GetSize() + 255) / 256);
-
-	for (int block = 0; block < blocks; ++block)
-	{
-		int size = GetDisplayIdBlockSize(block);
-
-		if (size < 5)
-			continue;
-
-		if (!IsValidChecksum(block * 256, size))
-			return false;
-	}
-
-	return true;
-}
-
-////////////////////////////////////////////////////////////////////////////
-
 bool EDW::DisplayDataImpl::FixDisplayIdChecksums()
 {
 	if (GetSize() < 5)
@@ -1194,7 +964,7 @@ bool EDW::DisplayDataImpl::FixDisplayIdChecksums()
 
 	for (int block = 0; block < blocks; ++block)
 	{
-		int size = GetDisplayIdBlockSize(block);
+		int size = GetView().GetDisplayIdBlockSize(block);
 
 		if (size < 5)
 			continue;
@@ -1208,29 +978,6 @@ bool EDW::DisplayDataImpl::FixDisplayIdChecksums()
 
 ////////////////////////////////////////////////////////////////////////////
 
-bool EDW::DisplayDataImpl::IsValidChecksum(int offset, int size, unsigned char add) const
-{
-	if (offset < 0 || size < 1)
-		return false;
-
-	int end = offset + size - 1;
-
-	if (GetSize() <= end)
-		return false;
-
-	unsigned char checksum = add;
-
-	for (int index = offset; index < end; ++index)
-		checksum -= data[index];
-
-	if (data[end] != checksum)
-		return false;
-
-	return true;
-}
-
-////////////////////////////////////////////////////////////////////////////
-
 bool EDW::DisplayDataImpl::FixChecksum(int offset, int size)
 {
 	if (offset < 0 || size < 1)
@@ -1241,39 +988,13 @@ bool EDW::DisplayDataImpl::FixChecksum(int offset, int size)
 	if (GetSize() <= end)
 		return false;
 
-	unsigned char checksum = 0;
+	unsigned char checksum = -Kernels::Sum(data + offset, size - 1);
 
-	for (int index = offset; index < end; ++index)
-		checksum -= data[index];
+	if (data[end] != checksum)
+	{
+		data[end] = checksum;
+		MarkDirty(end, 1);
+	}
 
-	data[end] = checksum;
 	return true;
 }
-
-////////////////////////////////////////////////////////////////////////////
-
-int EDW::DisplayDataImpl::FromHex(int value)
-{
-	if (value >= '0' && value <= '9')
-		return value - '0';
-
-	if (value >= 'A' && value <= 'F')
-		return value - 'A' + 10;
-
-	if (value >= 'a' && value <= 'f')
-		return value - 'a' + 10;
-
-	return 0;
-}
-
-////////////////////////////////////////////////////////////////////////////
-
-int EDW::DisplayDataImpl::ToHex(int value)
-{
-	if (value < 10)
-		return value + '0';
-
-	return value + 'A' - 10;
-}
-
-////////////////////////////////////////////////////////////////////////////
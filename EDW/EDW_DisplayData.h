@@ -3,6 +3,7 @@
 
 // Includes ////////////////////////////////////////////////////////////////
 
+#include "EDW_DisplayDataView.h"
 #include "EDW_Common.h"
 
 // Classes /////////////////////////////////////////////////////////////////
@@ -16,18 +17,31 @@ namespace EDW
 		// Public //////////////////////////////////////////////////////////
 		////////////////////////////////////////////////////////////////////
 
+		// Constants ///////////////////////////////////////////////////////
+
+		static const int LineSize = 8;
+		static const int MaxSize = 32768;
+
 		// Functions ///////////////////////////////////////////////////////
 
 		DisplayData();
 		DisplayData(const std::basic_string<unsigned char> &data);
+		DisplayData(const DisplayDataView &view);
 		DisplayData(const DisplayData &other);
+		DisplayData(DisplayData &&other) noexcept;
 		DisplayData &operator=(const DisplayData &other);
+		DisplayData &operator=(DisplayData &&other) noexcept;
 		~DisplayData();
 
 		explicit operator bool() const;
 		bool operator==(const DisplayData &other) const;
 		bool operator!=(const DisplayData &other) const;
 
+		DisplayDataView GetView() const;
+		bool GetEdidInfo(EdidInfo &info) const;
+		bool GetDisplayIdIndex(DisplayIdIndex &index) const;
+		bool GetCtaInfo(int block, CtaInfo &info) const;
+		bool GetDetailedTimings(std::vector<DetailedTiming> &timings) const;
 		bool GetData(std::basic_string<unsigned char> &data) const;
 		int GetSize() const;
 		int GetOriginalSize() const;
@@ -35,28 +49,54 @@ namespace EDW
 		template <class T> bool GetId(T &id) const;
 		template <class T> bool GetName(T &name) const;
 		template <class T> bool GetText(T &text, int columns = 0) const;
+		template <class T> bool GetFieldText(T &text) const;
 		template <class T> bool Load(const T &name);
 		template <class T> bool SaveBin(const T &name) const;
 		template <class T> bool SaveDat(const T &name) const;
 		template <class T> bool SaveTxt(const T &name, int columns = 16) const;
+		bool SetByte(int offset, unsigned char value);
+		bool SetRange(int offset, const unsigned char *data, int size);
+		template <class Field> bool SetField(unsigned value);
+		bool IsDirtyLine(int line) const;
+		bool IsSameOrigin(const DisplayData &other) const;
 		bool IsEdid() const;
 		bool IsValidEdidHeader() const;
+		bool IsValidEdidFields() const;
 		bool FixEdidHeader();
 		bool IsValidEdidExtensionBlocks() const;
 		bool FixEdidExtensionBlocks();
 		bool IsValidEdidChecksums() const;
+		bool HasVic(int vic) const;
 		bool FixEdidChecksums();
 		bool IsDisplayId() const;
 		bool IsValidDisplayIdChecksums() const;
 		bool FixDisplayIdChecksums();
 
+		static bool GetModeTable(const std::vector<DisplayData> &displayData, ModeTable &table);
+
 		////////////////////////////////////////////////////////////////////
 
 	private:
-		std::unique_ptr<struct DisplayDataImpl> impl;
+		bool Detach();
+
+		std::shared_ptr<struct DisplayDataImpl> impl;
 	};
 }
 
+// Functions ///////////////////////////////////////////////////////////////
+
+template <class Field>
+bool EDW::DisplayData::SetField(unsigned value)
+{
+	if (GetSize() < Field::Offset + Field::Size)
+		return false;
+
+	unsigned char data[Field::Offset + Field::Size];
+	std::memcpy(data + Field::Offset, GetView().GetData() + Field::Offset, Field::Size);
+	Field::Set(data, value);
+	return SetRange(Field::Offset, data + Field::Offset, Field::Size);
+}
+
 ////////////////////////////////////////////////////////////////////////////
 
 #endif
@@ -0,0 +1,1181 @@
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW.h"
+
+// Functions ///////////////////////////////////////////////////////////////
+
+EDW::DisplayDataView::DisplayDataView() :
+	data(nullptr),
+	dataSize(0),
+	cache(nullptr)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::DisplayDataView::DisplayDataView(const unsigned char *data, int size, const DisplayDataCache *cache) :
+	data(data),
+	dataSize(size),
+	cache(cache)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::DisplayDataView::DisplayDataView(const std::basic_string<unsigned char> &data) :
+	data(data.data()),
+	dataSize(static_cast<int>(data.size())),
+	cache(nullptr)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+const unsigned char *EDW::DisplayDataView::GetData() const
+{
+	return data;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+int EDW::DisplayDataView::GetSize() const
+{
+	return dataSize;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+int EDW::DisplayDataView::GetReportedSize() const
+{
+	if (IsEdid())
+		return (cache ? cache->Edid.ExtensionCount : static_cast<int>(EdidSchema::ExtensionCount::Get(data))) * 128 + 128;
+
+	if (IsDisplayId())
+	{
+		int lastBlockSize = GetDisplayIdBlockSize(data[3]);
+
+		if (lastBlockSize < 5)
+			lastBlockSize = 256;
+
+		return data[3] * 256 + lastBlockSize;
+	}
+
+	return GetSize();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+int EDW::DisplayDataView::GetDisplayIdBlockSize(int block) const
+{
+	if (block < 0)
+		return 0;
+
+	int offset = block * 256;
+	int end = offset + 5;
+
+	if (GetSize() < end)
+		return 0;
+
+	if (data[offset] < 0x10)
+		return 0;
+
+	int index = offset + 1;
+	int size = data[index] + 5;
+
+	if (size > 256)
+		return 0;
+
+	end = offset + size;
+
+	if (GetSize() < end)
+		return 0;
+
+	return size;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+int EDW::DisplayDataView::GetChecksumOffset(int offset) const
+{
+	if (IsEdid())
+	{
+		int block = offset / 128;
+
+		if (block * 128 + 128 > GetSize())
+			return -1;
+
+		if (block > 0 && !IsValidEdidExtensionBlock(block))
+			return -1;
+
+		return block * 128 + 127;
+	}
+
+	if (IsDisplayId())
+	{
+		int section = offset / 256;
+		int size = GetDisplayIdBlockSize(section);
+
+		if (size < 5 || offset >= section * 256 + size)
+			return -1;
+
+		return section * 256 + size - 1;
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::Decode(DisplayDataCache &cache) const
+{
+	DecodeEdidInfo(cache.Edid);
+	DecodeDisplayIdIndex(cache.DisplayId);
+	cache.Cta.clear();
+
+	if (IsEdid())
+	{
+		int blocks = std::min<int>(EdidSchema::ExtensionCount::Get(data), GetSize() / 128 - 1);
+
+		for (int block = 1; block <= blocks; ++block)
+		{
+			CtaInfo info;
+
+			if (DecodeCtaInfo(block, info))
+				cache.Cta.push_back(info);
+		}
+	}
+
+	DecodeDetailedTimings(cache.Timings);
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::Decode(DisplayDataCache &cache, int offset, int size) const
+{
+	if (offset < 0 || size < 1)
+		return false;
+
+	if (!IsEdid())
+	{
+		if (offset < 256)
+			return Decode(cache);
+
+		DecodeDisplayIdIndex(cache.DisplayId);
+		return true;
+	}
+
+	if (offset < 128)
+		return Decode(cache);
+
+	if (offset < 256)
+	{
+		DecodeEdidInfo(cache.Edid);
+		DecodeDisplayIdIndex(cache.DisplayId);
+	}
+
+	int blocks = std::min<int>(EdidSchema::ExtensionCount::Get(data), GetSize() / 128 - 1);
+	int end = std::min((offset + size - 1) / 128, blocks);
+
+	for (int block = offset / 128; block <= end; ++block)
+	{
+		cache.Cta.erase(std::remove_if(cache.Cta.begin(), cache.Cta.end(), [block](const CtaInfo &cta) { return cta.Block == block; }), cache.Cta.end());
+		cache.Timings.erase(std::remove_if(cache.Timings.begin(), cache.Timings.end(), [block](const DetailedTiming &timing) { return timing.Block == block; }), cache.Timings.end());
+		CtaInfo info;
+
+		if (!DecodeCtaInfo(block, info))
+			continue;
+
+		cache.Cta.insert(std::find_if(cache.Cta.begin(), cache.Cta.end(), [block](const CtaInfo &cta) { return cta.Block > block; }), info);
+		auto position = std::find_if(cache.Timings.begin(), cache.Timings.end(), [block](const DetailedTiming &timing) { return timing.Block > block; });
+		CtaIterator iterator(*this, block);
+		CtaDataBlock dataBlock;
+		DetailedTiming timing;
+
+		while (iterator.Next(dataBlock))
+		{
+			if (dataBlock.Tag == CtaDetailedTimingTag && GetDetailedTiming(dataBlock.Offset, timing))
+				position = cache.Timings.insert(position, timing) + 1;
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::GetEdidInfo(EdidInfo &info) const
+{
+	if (cache)
+		info = cache->Edid;
+	else
+		DecodeEdidInfo(info);
+
+	return GetSize() >= 128;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::DecodeEdidInfo(EdidInfo &info) const
+{
+	info = EdidInfo();
+
+	if (IsEdid())
+		info.Flags |= EdidFlag;
+
+	if (IsValidEdidHeader())
+		info.Flags |= ValidEdidHeaderFlag;
+
+	if (IsCorruptedEdidHeader())
+		info.Flags |= CorruptedEdidHeaderFlag;
+
+	if (IsDisplayId())
+		info.Flags |= DisplayIdFlag;
+
+	if (GetSize() < 128)
+		return false;
+
+	info.Vendor[0] = 64 | EdidSchema::ManufacturerLetter<0>::Get(data);
+	info.Vendor[1] = 64 | EdidSchema::ManufacturerLetter<1>::Get(data);
+	info.Vendor[2] = 64 | EdidSchema::ManufacturerLetter<2>::Get(data);
+	info.Vendor[3] = 0;
+	info.Product = EdidSchema::ProductCode::Get(data);
+	info.Serial = EdidSchema::SerialNumber::Get(data);
+	info.Week = EdidSchema::Week::Get(data);
+	info.Year = EdidSchema::Year::Get(data) + 1990;
+	info.Version = EdidSchema::Version::Get(data);
+	info.Revision = EdidSchema::Revision::Get(data);
+	info.ExtensionCount = EdidSchema::ExtensionCount::Get(data);
+
+	for (int slot = 0; slot < EdidSchema::DescriptorCount; ++slot)
+	{
+		int offset = EdidSchema::DescriptorOffset + slot * EdidSchema::DescriptorSize;
+		const unsigned char *byte = data + offset;
+		EdidDescriptor &descriptor = info.Descriptors[slot];
+		descriptor.Offset = offset;
+		descriptor.Tag = -1;
+		descriptor.Timing = byte[0] != 0x00 || byte[1] != 0x00;
+
+		if (byte[0] == 0x00 && byte[1] == 0x00 && byte[2] == 0x00 && byte[4] == 0x00)
+			descriptor.Tag = byte[3];
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::GetDisplayIdIndex(DisplayIdIndex &index) const
+{
+	if (cache)
+		index = cache->DisplayId;
+	else
+		DecodeDisplayIdIndex(index);
+
+	return index.Sections > 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::DecodeDisplayIdIndex(DisplayIdIndex &index) const
+{
+	index.Sections = 0;
+	index.Blocks = 0;
+	std::fill(std::begin(index.Offsets), std::end(index.Offsets), -1);
+
+	if (!IsDisplayId())
+		return false;
+
+	index.Sections = std::min(data[3] + 1, (GetSize() + 255) / 256);
+	DisplayIdIterator iterator(*this);
+	DisplayIdDataBlock block;
+
+	while (iterator.Next(block))
+	{
+		++index.Blocks;
+
+		if (block.Size > 0 && index.Offsets[block.Tag] < 0)
+			index.Offsets[block.Tag] = block.Offset;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::GetDisplayIdDataBlock(int tag, DisplayIdDataBlock &block) const
+{
+	if (tag < 0 || tag > 255)
+		return false;
+
+	if (cache)
+		return GetDisplayIdDataBlockAt(cache->DisplayId.Offsets[tag], block);
+
+	if (!IsDisplayId())
+		return false;
+
+	DisplayIdIterator iterator(*this);
+
+	while (iterator.Next(block))
+	{
+		if (block.Tag == tag && block.Size > 0)
+			return true;
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::GetDisplayIdDataBlockAt(int offset, DisplayIdDataBlock &block) const
+{
+	if (offset < 0)
+		return false;
+
+	int end = offset + 3;
+
+	if (GetSize() < end)
+		return false;
+
+	end += data[offset + 2];
+
+	if (GetSize() < end)
+		return false;
+
+	block.Section = offset / 256;
+	block.Offset = offset;
+	block.Tag = data[offset];
+	block.Revision = data[offset + 1];
+	block.Size = data[offset + 2];
+	block.Data = data + offset + 3;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::GetCtaInfo(int block, CtaInfo &info) const
+{
+	if (!cache)
+		return DecodeCtaInfo(block, info);
+
+	for (const CtaInfo &cta : cache->Cta)
+	{
+		if (cta.Block == block)
+		{
+			info = cta;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::DecodeCtaInfo(int block, CtaInfo &info) const
+{
+	if (!IsCta(block))
+		return false;
+
+	const unsigned char *byte = data + block * 128;
+	info.Block = block;
+	info.Revision = byte[1];
+	info.Flags = 0;
+	info.DataBlocks = 0;
+	info.DetailedTimings = 0;
+	info.NativeDetailedTimings = byte[3] & 15;
+	info.AudioFormats = 0;
+	info.SpeakerAllocation = 0;
+	info.Colorimetry = 0;
+	info.HdrEotfs = 0;
+	info.VicCount = 0;
+
+	if (byte[3] & 0x80)
+		info.Flags |= CtaUnderscanFlag;
+
+	if (byte[3] & 0x40)
+		info.Flags |= CtaBasicAudioFlag;
+
+	if (byte[3] & 0x20)
+		info.Flags |= CtaYCbCr444Flag;
+
+	if (byte[3] & 0x10)
+		info.Flags |= CtaYCbCr422Flag;
+
+	CtaIterator iterator(*this, block);
+	CtaDataBlock dataBlock;
+
+	while (iterator.Next(dataBlock))
+	{
+		const unsigned char *payload = dataBlock.Data;
+
+		switch (dataBlock.Tag)
+		{
+		case CtaAudioTag:
+			for (int index = 0; index + 3 <= dataBlock.Size; index += 3)
+				info.AudioFormats |= 1 << ((payload[index] >> 3) & 15);
+
+			break;
+
+		case CtaVideoTag:
+			for (int index = 0; index < dataBlock.Size && info.VicCount < static_cast<int>(sizeof(info.Vics)); ++index)
+				info.Vics[info.VicCount++] = payload[index] > 128 && payload[index] <= 192 ? payload[index] & 0x7F : payload[index];
+
+			break;
+
+		case CtaVendorTag:
+			if (dataBlock.Size >= 3 && payload[0] == 0x03 && payload[1] == 0x0C && payload[2] == 0x00)
+				info.Flags |= CtaHdmiFlag;
+
+			if (dataBlock.Size >= 3 && payload[0] == 0xD8 && payload[1] == 0x5D && payload[2] == 0xC4)
+				info.Flags |= CtaHdmiForumFlag;
+
+			break;
+
+		case CtaSpeakerTag:
+			if (dataBlock.Size >= 2)
+				info.SpeakerAllocation = payload[0] | payload[1] << 8;
+
+			break;
+
+		case CtaExtendedTag:
+			if (dataBlock.ExtendedTag == CtaColorimetryTag && dataBlock.Size >= 3)
+			{
+				info.Flags |= CtaColorimetryFlag;
+				info.Colorimetry = payload[1] | payload[2] << 8;
+			}
+
+			if (dataBlock.ExtendedTag == CtaHdrStaticMetadataTag && dataBlock.Size >= 3)
+			{
+				info.Flags |= CtaHdrStaticMetadataFlag;
+				info.HdrEotfs = payload[1];
+
+				if (payload[1] & 0x04)
+					info.Flags |= CtaHdr10Flag;
+
+				if (payload[1] & 0x08)
+					info.Flags |= CtaHlgFlag;
+			}
+
+			break;
+
+		case CtaDetailedTimingTag:
+			++info.DetailedTimings;
+			continue;
+		}
+
+		++info.DataBlocks;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::GetCtaDataBlock(int block, int tag, int extendedTag, CtaDataBlock &dataBlock) const
+{
+	CtaIterator iterator(*this, block);
+
+	while (iterator.Next(dataBlock))
+	{
+		if (dataBlock.Tag == tag && (tag != CtaExtendedTag || dataBlock.ExtendedTag == extendedTag))
+			return true;
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::GetDetailedTiming(int offset, DetailedTiming &timing) const
+{
+	if (offset < 0 || GetSize() < offset + EdidSchema::DescriptorSize)
+		return false;
+
+	const unsigned char *byte = data + offset;
+
+	if (byte[0] == 0x00 && byte[1] == 0x00)
+		return false;
+
+	timing.Block = offset / 128;
+	timing.Offset = offset;
+	timing.PixelClock = (byte[1] << 8 | byte[0]) * 10;
+	timing.HorizontalActive = (byte[4] & 0xF0) << 4 | byte[2];
+	timing.HorizontalBlanking = (byte[4] & 0x0F) << 8 | byte[3];
+	timing.VerticalActive = (byte[7] & 0xF0) << 4 | byte[5];
+	timing.VerticalBlanking = (byte[7] & 0x0F) << 8 | byte[6];
+	timing.HorizontalSyncOffset = (byte[11] & 0xC0) << 2 | byte[8];
+	timing.HorizontalSyncWidth = (byte[11] & 0x30) << 4 | byte[9];
+	timing.VerticalSyncOffset = (byte[11] & 0x0C) << 2 | byte[10] >> 4;
+	timing.VerticalSyncWidth = (byte[11] & 0x03) << 4 | (byte[10] & 0x0F);
+	timing.HorizontalImageSize = (byte[14] & 0xF0) << 4 | byte[12];
+	timing.VerticalImageSize = (byte[14] & 0x0F) << 8 | byte[13];
+	timing.HorizontalBorder = byte[15];
+	timing.VerticalBorder = byte[16];
+	timing.Flags = byte[17];
+	timing.Interlaced = (byte[17] & 0x80) != 0;
+
+	int total = (timing.HorizontalActive + timing.HorizontalBlanking) * (timing.VerticalActive + timing.VerticalBlanking);
+	timing.RefreshRate = total > 0 ? timing.PixelClock * 1000.0f / total : 0.0f;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::GetDetailedTimings(std::vector<DetailedTiming> &timings) const
+{
+	if (cache)
+		timings = cache->Timings;
+	else
+		DecodeDetailedTimings(timings);
+
+	return !timings.empty();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::DecodeDetailedTimings(std::vector<DetailedTiming> &timings) const
+{
+	timings.clear();
+
+	if (!IsEdid())
+		return false;
+
+	DetailedTiming timing;
+
+	for (int slot = 0; slot < EdidSchema::DescriptorCount; ++slot)
+	{
+		if (GetDetailedTiming(EdidSchema::DescriptorOffset + slot * EdidSchema::DescriptorSize, timing))
+			timings.push_back(timing);
+	}
+
+	int blocks = std::min<int>(EdidSchema::ExtensionCount::Get(data), GetSize() / 128 - 1);
+
+	for (int block = 1; block <= blocks; ++block)
+	{
+		CtaIterator iterator(*this, block);
+		CtaDataBlock dataBlock;
+
+		while (iterator.Next(dataBlock))
+		{
+			if (dataBlock.Tag == CtaDetailedTimingTag && GetDetailedTiming(dataBlock.Offset, timing))
+				timings.push_back(timing);
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+bool EDW::DisplayDataView::GetId(T &id) const
+{
+	if (IsEdid())
+	{
+		if (GetEdidId(id))
+			return true;
+	}
+	else if (IsDisplayId())
+	{
+		if (data[0] < 0x20)
+		{
+			if (GetDisplayIdId(id, 0x00))
+				return true;
+
+			if (GetDisplayIdId(id, 0x20))
+				return true;
+		}
+		else
+		{
+			if (GetDisplayIdId(id, 0x20))
+				return true;
+
+			if (GetDisplayIdId(id, 0x00))
+				return true;
+		}
+	}
+
+	return false;
+}
+
+template bool EDW::DisplayDataView::GetId(std::string &id) const;
+template bool EDW::DisplayDataView::GetId(std::wstring &id) const;
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+bool EDW::DisplayDataView::GetEdidId(T &id) const
+{
+	if (GetSize() < 128)
+		return false;
+
+	if (cache)
+	{
+		id.clear();
+		id.push_back(cache->Edid.Vendor[0]);
+		id.push_back(cache->Edid.Vendor[1]);
+		id.push_back(cache->Edid.Vendor[2]);
+		id.push_back(ToHex(cache->Edid.Product >> 12 & 15));
+		id.push_back(ToHex(cache->Edid.Product >> 8 & 15));
+		id.push_back(ToHex(cache->Edid.Product >> 4 & 15));
+		id.push_back(ToHex(cache->Edid.Product & 15));
+		return true;
+	}
+
+	id.clear();
+	unsigned product = EdidSchema::ProductCode::Get(data);
+	id.push_back(64 | EdidSchema::ManufacturerLetter<0>::Get(data));
+	id.push_back(64 | EdidSchema::ManufacturerLetter<1>::Get(data));
+	id.push_back(64 | EdidSchema::ManufacturerLetter<2>::Get(data));
+	id.push_back(ToHex(product >> 12 & 15));
+	id.push_back(ToHex(product >> 8 & 15));
+	id.push_back(ToHex(product >> 4 & 15));
+	id.push_back(ToHex(product & 15));
+	return true;
+}
+
+template bool EDW::DisplayDataView::GetEdidId(std::string &id) const;
+template bool EDW::DisplayDataView::GetEdidId(std::wstring &id) const;
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+bool EDW::DisplayDataView::GetDisplayIdId(T &id, unsigned char tag) const
+{
+	DisplayIdDataBlock block;
+
+	if (!GetDisplayIdDataBlock(tag, block) || block.Size < 5)
+		return false;
+
+	const unsigned char *byte = block.Data - 3;
+	id.clear();
+
+	if (tag == 0x00 && std::isgraph(byte[3]) && std::isgraph(byte[4]) && std::isgraph(byte[5]))
+	{
+		id.push_back(byte[3]);
+		id.push_back(byte[4]);
+		id.push_back(byte[5]);
+	}
+	else
+	{
+		id.push_back(ToHex(byte[3] >> 4));
+		id.push_back(ToHex(byte[3] & 15));
+		id.push_back(ToHex(byte[4] >> 4));
+		id.push_back(ToHex(byte[4] & 15));
+		id.push_back(ToHex(byte[5] >> 4));
+		id.push_back(ToHex(byte[5] & 15));
+	}
+
+	id.push_back(ToHex(byte[7] >> 4));
+	id.push_back(ToHex(byte[7] & 15));
+	id.push_back(ToHex(byte[6] >> 4));
+	id.push_back(ToHex(byte[6] & 15));
+	return true;
+}
+
+template bool EDW::DisplayDataView::GetDisplayIdId(std::string &id, unsigned char tag) const;
+template bool EDW::DisplayDataView::GetDisplayIdId(std::wstring &id, unsigned char tag) const;
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+bool EDW::DisplayDataView::GetName(T &name) const
+{
+	if (IsEdid())
+	{
+		if (GetEdidName(name, 0xFC))
+			return true;
+
+		if (GetEdidName(name, 0xFE))
+			return true;
+	}
+	else if (IsDisplayId())
+	{
+		if (data[0] < 0x20)
+		{
+			if (GetDisplayIdName(name, 0x00))
+				return true;
+
+			if (GetDisplayIdName(name, 0x20))
+				return true;
+		}
+		else
+		{
+			if (GetDisplayIdName(name, 0x20))
+				return true;
+
+			if (GetDisplayIdName(name, 0x00))
+				return true;
+		}
+	}
+
+	return false;
+}
+
+template bool EDW::DisplayDataView::GetName(std::string &name) const;
+template bool EDW::DisplayDataView::GetName(std::wstring &name) const;
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+bool EDW::DisplayDataView::GetEdidName(T &name, unsigned char tag) const
+{
+	if (GetSize() < 128)
+		return false;
+
+	for (int slot = 0; slot < EdidSchema::DescriptorCount; ++slot)
+	{
+		int offset = EdidSchema::DescriptorOffset + slot * EdidSchema::DescriptorSize;
+		const unsigned char *byte = data + offset;
+
+		if (cache ? cache->Edid.Descriptors[slot].Tag == tag : byte[0] == 0x00 && byte[1] == 0x00 && byte[2] == 0x00 && byte[3] == tag && byte[4] == 0x00)
+		{
+			name.clear();
+			int size = 13;
+			int begin = 5;
+			int end = begin + size;
+
+			for (int index = begin; index < end && byte[index] != 0x0A && byte[index] != 0x00; ++index)
+				name.push_back(byte[index]);
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+template bool EDW::DisplayDataView::GetEdidName(std::string &name, unsigned char tag) const;
+template bool EDW::DisplayDataView::GetEdidName(std::wstring &name, unsigned char tag) const;
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+bool EDW::DisplayDataView::GetDisplayIdName(T &name, unsigned char tag) const
+{
+	DisplayIdDataBlock block;
+
+	if (!GetDisplayIdDataBlock(tag, block) || block.Size < 12)
+		return false;
+
+	const unsigned char *byte = block.Data - 3;
+	name.clear();
+	int size = std::min<int>(byte[14], byte[2] - 12);
+	int begin = 15;
+	int end = begin + size;
+
+	for (int index = begin; index < end; ++index)
+		name.push_back(byte[index]);
+
+	return true;
+}
+
+template bool EDW::DisplayDataView::GetDisplayIdName(std::string &name, unsigned char tag) const;
+template bool EDW::DisplayDataView::GetDisplayIdName(std::wstring &name, unsigned char tag) const;
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+bool EDW::DisplayDataView::GetFieldText(T &text) const
+{
+	text.clear();
+
+	if (GetSize() < 128)
+		return false;
+
+	EdidSchema::Fields::ForEach([this, &text](auto field)
+	{
+		typedef decltype(field) Field;
+		std::string value = Field::Type == EdidHexField ? "0x" : "";
+		unsigned number = Field::Get(data);
+
+		if (Field::Type == EdidHexField)
+		{
+			for (int shift = (Field::Bits + 3) / 4 * 4 - 4; shift >= 0; shift -= 4)
+				value.push_back(ToHex(number >> shift & 15));
+		}
+		else
+		{
+			value += std::to_string(number);
+		}
+
+		for (const char *name = Field::GetName(); *name; ++name)
+			text.push_back(*name);
+
+		text.push_back(' ');
+		text.push_back('=');
+		text.push_back(' ');
+		text.insert(text.end(), value.begin(), value.end());
+
+		if (!Field::IsValid(data))
+		{
+			text.push_back(' ');
+			text.push_back('!');
+		}
+
+		text.push_back('\r');
+		text.push_back('\n');
+	});
+
+	return true;
+}
+
+template bool EDW::DisplayDataView::GetFieldText(std::string &text) const;
+template bool EDW::DisplayDataView::GetFieldText(std::wstring &text) const;
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+bool EDW::DisplayDataView::GetText(T &text, int columns) const
+{
+	return Hex::Encode(text, data, GetSize(), columns);
+}
+
+template bool EDW::DisplayDataView::GetText(std::string &text, int columns) const;
+template bool EDW::DisplayDataView::GetText(std::wstring &text, int columns) const;
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsEdid() const
+{
+	if (cache)
+		return (cache->Edid.Flags & EdidFlag) != 0;
+
+	if (GetSize() < 128)
+		return false;
+
+	if (!IsValidEdidHeader() && !IsCorruptedEdidHeader())
+		return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsValidEdidHeader() const
+{
+	if (cache)
+		return (cache->Edid.Flags & ValidEdidHeaderFlag) != 0;
+
+	if (GetSize() < 128)
+		return false;
+
+	if (!Kernels::IsEqual(data, EdidHeader, sizeof(EdidHeader)))
+		return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsCorruptedEdidHeader() const
+{
+	if (cache)
+		return (cache->Edid.Flags & CorruptedEdidHeaderFlag) != 0;
+
+	if (GetSize() < 128)
+		return false;
+
+	if (!EdidSchema::Version::IsValid(data) || !EdidSchema::Revision::IsValid(data))
+		return false;
+
+	return IsValidChecksum(8, 120, 6);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsValidEdidFields() const
+{
+	if (GetSize() < 128)
+		return false;
+
+	return EdidSchema::Fields::IsValid(data);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsValidEdidExtensionBlock(int block) const
+{
+	if (block < 1)
+		return false;
+
+	int offset = block * 128;
+	int end = offset + 128;
+
+	if (GetSize() < end)
+		return false;
+
+	if (Kernels::IsEqual(data + offset, EdidHeader, sizeof(EdidHeader)))
+		return false;
+
+	if (Kernels::IsFilled(data + offset, 127, 0x00))
+		return false;
+
+	if (Kernels::IsFilled(data + offset, 127, 0xFF))
+		return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsValidEdidExtensionBlocks() const
+{
+	if (GetSize() < 128)
+		return false;
+
+	int blocks = std::min<int>(EdidSchema::ExtensionCount::Get(data) + 1, (GetSize() + 127) / 128);
+
+	for (int block = 1; block < blocks; ++block)
+	{
+		if (!IsValidEdidExtensionBlock(block))
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsValidEdidChecksums() const
+{
+	if (GetSize() < 128)
+		return false;
+
+	if (!IsValidChecksum(0, 128))
+		return false;
+
+	int blocks = std::min<int>(EdidSchema::ExtensionCount::Get(data) + 1, GetSize() / 128);
+
+	for (int block = 1; block < blocks; ++block)
+	{
+		if (!IsValidEdidExtensionBlock(block))
+			continue;
+
+		if (!IsValidChecksum(block * 128, 128))
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsCta(int block) const
+{
+	if (!IsValidEdidExtensionBlock(block))
+		return false;
+
+	if (data[block * 128] != 0x02)
+		return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::HasVic(int vic) const
+{
+	CtaInfo info;
+	int blocks = std::min(GetReportedSize(), GetSize()) / 128 - 1;
+
+	for (int block = 1; block <= blocks; ++block)
+	{
+		if (GetCtaInfo(block, info) && std::find(info.Vics, info.Vics + info.VicCount, vic) != info.Vics + info.VicCount)
+			return true;
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsDisplayId() const
+{
+	if (cache)
+		return (cache->Edid.Flags & DisplayIdFlag) != 0;
+
+	int size = GetDisplayIdBlockSize(0);
+
+	if (size < 5)
+		return false;
+
+	int end = size - 1;
+	int bytes = 5;
+
+	for (int index = 6; index < end; index += data[index] + 3)
+		bytes += data[index] + 3;
+
+	if (bytes > size)
+		return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsValidDisplayIdChecksums() const
+{
+	if (GetSize() < 5)
+		return false;
+
+	int blocks = std::min(data[3] + 1, (GetSize() + 255) / 256);
+
+	for (int block = 0; block < blocks; ++block)
+	{
+		int size = GetDisplayIdBlockSize(block);
+
+		if (size < 5)
+			continue;
+
+		if (!IsValidChecksum(block * 256, size))
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayDataView::IsValidChecksum(int offset, int size, unsigned char add) const
+{
+	if (offset < 0 || size < 1)
+		return false;
+
+	int end = offset + size - 1;
+
+	if (GetSize() <= end)
+		return false;
+
+	unsigned char checksum = add - Kernels::Sum(data + offset, size - 1);
+
+	if (data[end] != checksum)
+		return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+int EDW::DisplayDataView::FromHex(int value)
+{
+	if (value >= '0' && value <= '9')
+		return value - '0';
+
+	if (value >= 'A' && value <= 'F')
+		return value - 'A' + 10;
+
+	if (value >= 'a' && value <= 'f')
+		return value - 'a' + 10;
+
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+int EDW::DisplayDataView::ToHex(int value)
+{
+	if (value < 10)
+		return value + '0';
+
+	return value + 'A' - 10;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::DisplayIdIterator::DisplayIdIterator(const DisplayDataView &view) :
+	view(view),
+	sections(0),
+	section(-1),
+	offset(0),
+	end(0)
+{
+	if (view.GetSize() >= 5)
+		sections = std::min(view.GetData()[3] + 1, (view.GetSize() + 255) / 256);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::DisplayIdIterator::Next(DisplayIdDataBlock &block)
+{
+	while (true)
+	{
+		if (offset + 3 <= end && view.GetDisplayIdDataBlockAt(offset, block) && offset + 3 + block.Size <= end)
+		{
+			offset += 3 + block.Size;
+			return true;
+		}
+
+		if (++section >= sections)
+			return false;
+
+		int size = view.GetDisplayIdBlockSize(section);
+		offset = section * 256 + 4;
+		end = section * 256 + size - 1;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::CtaIterator::CtaIterator(const DisplayDataView &view, int block) :
+	data(view.GetData()),
+	block(block),
+	offset(0),
+	dataBlockEnd(0),
+	end(0)
+{
+	if (!view.IsCta(block))
+		return;
+
+	int base = block * 128;
+	int dtdOffset = data[base + 2];
+
+	if (dtdOffset < 4 || dtdOffset > 127)
+		return;
+
+	offset = base + 4;
+	dataBlockEnd = base + dtdOffset;
+	end = base + 127;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::CtaIterator::Next(CtaDataBlock &dataBlock)
+{
+	if (offset < dataBlockEnd)
+	{
+		int size = data[offset] & 31;
+
+		if (offset + 1 + size <= dataBlockEnd)
+		{
+			dataBlock.Block = block;
+			dataBlock.Offset = offset;
+			dataBlock.Tag = data[offset] >> 5;
+			dataBlock.ExtendedTag = dataBlock.Tag == CtaExtendedTag && size > 0 ? data[offset + 1] : -1;
+			dataBlock.Size = size;
+			dataBlock.Data = data + offset + 1;
+			offset += 1 + size;
+			return true;
+		}
+
+		offset = dataBlockEnd;
+	}
+
+	if (offset + 18 > end || (data[offset] == 0 && data[offset + 1] == 0))
+	{
+		offset = end;
+		return false;
+	}
+
+	dataBlock.Block = block;
+	dataBlock.Offset = offset;
+	dataBlock.Tag = CtaDetailedTimingTag;
+	dataBlock.ExtendedTag = -1;
+	dataBlock.Size = 18;
+	dataBlock.Data = data + offset;
+	offset += 18;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,322 @@
+#ifndef EDW_DISPLAYDATAVIEW_H
+#define EDW_DISPLAYDATAVIEW_H
+
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW_EdidSchema.h"
+#include "EDW_Common.h"
+
+// Enums ///////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	enum DisplayDataFlags
+	{
+		EdidFlag = 1 << 0,
+		ValidEdidHeaderFlag = 1 << 1,
+		CorruptedEdidHeaderFlag = 1 << 2,
+		DisplayIdFlag = 1 << 3
+	};
+
+	enum CtaFlags
+	{
+		CtaUnderscanFlag = 1 << 0,
+		CtaBasicAudioFlag = 1 << 1,
+		CtaYCbCr444Flag = 1 << 2,
+		CtaYCbCr422Flag = 1 << 3,
+		CtaHdmiFlag = 1 << 4,
+		CtaHdmiForumFlag = 1 << 5,
+		CtaColorimetryFlag = 1 << 6,
+		CtaHdrStaticMetadataFlag = 1 << 7,
+		CtaHdr10Flag = 1 << 8,
+		CtaHlgFlag = 1 << 9
+	};
+
+	enum CtaTags
+	{
+		CtaAudioTag = 1,
+		CtaVideoTag = 2,
+		CtaVendorTag = 3,
+		CtaSpeakerTag = 4,
+		CtaExtendedTag = 7,
+		CtaDetailedTimingTag = 8
+	};
+
+	enum CtaExtendedTags
+	{
+		CtaColorimetryTag = 5,
+		CtaHdrStaticMetadataTag = 6
+	};
+}
+
+// Structs /////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	struct EdidDescriptor
+	{
+		int Offset;
+		int Tag;
+		bool Timing;
+	};
+
+	struct EdidInfo
+	{
+		unsigned Flags;
+		char Vendor[4];
+		int Product;
+		unsigned Serial;
+		int Week;
+		int Year;
+		int Version;
+		int Revision;
+		int ExtensionCount;
+		EdidDescriptor Descriptors[4];
+	};
+
+	struct DisplayIdDataBlock
+	{
+		int Section;
+		int Offset;
+		int Tag;
+		int Revision;
+		int Size;
+		const unsigned char *Data;
+	};
+
+	struct DisplayIdIndex
+	{
+		int Sections;
+		int Blocks;
+		int Offsets[256];
+	};
+
+	struct CtaDataBlock
+	{
+		int Block;
+		int Offset;
+		int Tag;
+		int ExtendedTag;
+		int Size;
+		const unsigned char *Data;
+	};
+
+	struct CtaInfo
+	{
+		int Block;
+		int Revision;
+		unsigned Flags;
+		int DataBlocks;
+		int DetailedTimings;
+		int NativeDetailedTimings;
+		unsigned AudioFormats;
+		unsigned SpeakerAllocation;
+		unsigned Colorimetry;
+		unsigned HdrEotfs;
+		int VicCount;
+		unsigned char Vics[64];
+	};
+
+	struct DetailedTiming
+	{
+		int Block;
+		int Offset;
+		int PixelClock;
+		float RefreshRate;
+		unsigned short HorizontalActive;
+		unsigned short HorizontalBlanking;
+		unsigned short HorizontalSyncOffset;
+		unsigned short HorizontalSyncWidth;
+		unsigned short VerticalActive;
+		unsigned short VerticalBlanking;
+		unsigned short VerticalSyncOffset;
+		unsigned short VerticalSyncWidth;
+		unsigned short HorizontalImageSize;
+		unsigned short VerticalImageSize;
+		unsigned char HorizontalBorder;
+		unsigned char VerticalBorder;
+		unsigned char Flags;
+		bool Interlaced;
+	};
+
+	struct ModeTable
+	{
+		std::vector<DetailedTiming> Timings;
+		std::vector<int> Offsets;
+	};
+
+	struct DisplayDataCache
+	{
+		EdidInfo Edid;
+		DisplayIdIndex DisplayId;
+		std::vector<CtaInfo> Cta;
+		std::vector<DetailedTiming> Timings;
+	};
+}
+
+// Classes /////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	class DisplayDataView
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////////
+		// Public //////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Constants ///////////////////////////////////////////////////////
+
+		static constexpr unsigned char EdidHeader[8] = {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+
+		// Functions ///////////////////////////////////////////////////////
+
+		DisplayDataView();
+		DisplayDataView(const unsigned char *data, int size, const DisplayDataCache *cache = nullptr);
+		DisplayDataView(const std::basic_string<unsigned char> &data);
+		template <std::size_t Size> DisplayDataView(const std::array<unsigned char, Size> &data);
+
+		const unsigned char *GetData() const;
+		int GetSize() const;
+		int GetReportedSize() const;
+		int GetDisplayIdBlockSize(int block) const;
+		int GetChecksumOffset(int offset) const;
+		bool Decode(DisplayDataCache &cache) const;
+		bool Decode(DisplayDataCache &cache, int offset, int size) const;
+		bool GetEdidInfo(EdidInfo &info) const;
+		bool GetDisplayIdIndex(DisplayIdIndex &index) const;
+		bool GetDisplayIdDataBlock(int tag, DisplayIdDataBlock &block) const;
+		bool GetDisplayIdDataBlockAt(int offset, DisplayIdDataBlock &block) const;
+		bool GetCtaInfo(int block, CtaInfo &info) const;
+		bool GetCtaDataBlock(int block, int tag, int extendedTag, CtaDataBlock &dataBlock) const;
+		bool GetDetailedTiming(int offset, DetailedTiming &timing) const;
+		bool GetDetailedTimings(std::vector<DetailedTiming> &timings) const;
+		template <class T> bool GetId(T &id) const;
+		template <class T> bool GetName(T &name) const;
+		template <class T> bool GetText(T &text, int columns = 0) const;
+		template <class T> bool GetFieldText(T &text) const;
+		bool IsEdid() const;
+		bool IsValidEdidHeader() const;
+		bool IsCorruptedEdidHeader() const;
+		bool IsValidEdidFields() const;
+		bool IsValidEdidExtensionBlock(int block) const;
+		bool IsValidEdidExtensionBlocks() const;
+		bool IsValidEdidChecksums() const;
+		bool IsCta(int block) const;
+		bool HasVic(int vic) const;
+		bool IsDisplayId() const;
+		bool IsValidDisplayIdChecksums() const;
+		bool IsValidChecksum(int offset, int size, unsigned char add = 0) const;
+
+		static int FromHex(int value);
+		static int ToHex(int value);
+
+		////////////////////////////////////////////////////////////////////
+
+	private:
+
+		////////////////////////////////////////////////////////////////////
+		// Private /////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Functions ///////////////////////////////////////////////////////
+
+		bool DecodeEdidInfo(EdidInfo &info) const;
+		bool DecodeDisplayIdIndex(DisplayIdIndex &index) const;
+		bool DecodeCtaInfo(int block, CtaInfo &info) const;
+		bool DecodeDetailedTimings(std::vector<DetailedTiming> &timings) const;
+		template <class T> bool GetEdidId(T &id) const;
+		template <class T> bool GetDisplayIdId(T &id, unsigned char tag) const;
+		template <class T> bool GetEdidName(T &name, unsigned char tag) const;
+		template <class T> bool GetDisplayIdName(T &name, unsigned char tag) const;
+
+		// Variables ///////////////////////////////////////////////////////
+
+		const unsigned char *data;
+		int dataSize;
+		const DisplayDataCache *cache;
+
+		////////////////////////////////////////////////////////////////////
+	};
+
+	class DisplayIdIterator
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////////
+		// Public //////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Functions ///////////////////////////////////////////////////////
+
+		DisplayIdIterator(const DisplayDataView &view);
+
+		bool Next(DisplayIdDataBlock &block);
+
+		////////////////////////////////////////////////////////////////////
+
+	private:
+
+		////////////////////////////////////////////////////////////////////
+		// Private /////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Variables ///////////////////////////////////////////////////////
+
+		DisplayDataView view;
+		int sections;
+		int section;
+		int offset;
+		int end;
+
+		////////////////////////////////////////////////////////////////////
+	};
+
+	class CtaIterator
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////////
+		// Public //////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Functions ///////////////////////////////////////////////////////
+
+		CtaIterator(const DisplayDataView &view, int block);
+
+		bool Next(CtaDataBlock &dataBlock);
+
+		////////////////////////////////////////////////////////////////////
+
+	private:
+
+		////////////////////////////////////////////////////////////////////
+		// Private /////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Variables ///////////////////////////////////////////////////////
+
+		const unsigned char *data;
+		int block;
+		int offset;
+		int dataBlockEnd;
+		int end;
+
+		////////////////////////////////////////////////////////////////////
+	};
+}
+
+// Functions ///////////////////////////////////////////////////////////////
+
+template <std::size_t Size>
+EDW::DisplayDataView::DisplayDataView(const std::array<unsigned char, Size> &data) :
+	data(data.data()),
+	dataSize(static_cast<int>(Size)),
+	cache(nullptr)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+#endif
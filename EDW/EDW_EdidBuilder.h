@@ -0,0 +1,199 @@
+#ifndef EDW_EDIDBUILDER_H
+#define EDW_EDIDBUILDER_H
+
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW_DisplayDataView.h"
+#include "EDW_EdidSchema.h"
+#include "EDW_Common.h"
+
+// Classes /////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	template <int Blocks = 1>
+	class EdidBuilder
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////////
+		// Public //////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Constants ///////////////////////////////////////////////////////
+
+		static constexpr int Size = Blocks * 128;
+
+		static_assert(Blocks >= 1 && Blocks <= 256, "EDID must have between 1 and 256 blocks");
+
+		// Functions ///////////////////////////////////////////////////////
+
+		constexpr EdidBuilder() :
+			data()
+		{
+			for (int index = 0; index < 8; ++index)
+				data[index] = DisplayDataView::EdidHeader[index];
+
+			EdidSchema::Version::Set(data.data(), 1);
+			EdidSchema::Revision::Set(data.data(), 4);
+			EdidSchema::ExtensionCount::Set(data.data(), Blocks - 1);
+		}
+
+		constexpr EdidBuilder &SetVendor(const char *vendor)
+		{
+			EdidSchema::ManufacturerLetter<0>::Set(data.data(), vendor[0] - 64);
+			EdidSchema::ManufacturerLetter<1>::Set(data.data(), vendor[1] - 64);
+			EdidSchema::ManufacturerLetter<2>::Set(data.data(), vendor[2] - 64);
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetProduct(unsigned product)
+		{
+			EdidSchema::ProductCode::Set(data.data(), product);
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetSerial(unsigned serial)
+		{
+			EdidSchema::SerialNumber::Set(data.data(), serial);
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetDate(int week, int year)
+		{
+			EdidSchema::Week::Set(data.data(), week);
+			EdidSchema::Year::Set(data.data(), year - 1990);
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetVersion(int version, int revision)
+		{
+			EdidSchema::Version::Set(data.data(), version);
+			EdidSchema::Revision::Set(data.data(), revision);
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetDigitalInput(int bitDepth, int videoInterface)
+		{
+			EdidSchema::DigitalInput::Set(data.data(), 1);
+			EdidSchema::BitDepth::Set(data.data(), bitDepth);
+			EdidSchema::VideoInterface::Set(data.data(), videoInterface);
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetScreenSize(int horizontal, int vertical)
+		{
+			EdidSchema::HorizontalScreenSize::Set(data.data(), horizontal);
+			EdidSchema::VerticalScreenSize::Set(data.data(), vertical);
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetGamma(int gamma)
+		{
+			EdidSchema::Gamma::Set(data.data(), gamma - 100);
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetByte(int offset, unsigned char value)
+		{
+			data[offset] = value;
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetDescriptor(int slot, const unsigned char (&descriptor)[18])
+		{
+			int offset = EdidSchema::DescriptorOffset + slot * EdidSchema::DescriptorSize;
+
+			for (int index = 0; index < EdidSchema::DescriptorSize; ++index)
+				data[offset + index] = descriptor[index];
+
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetTextDescriptor(int slot, unsigned char tag, const char *text)
+		{
+			int offset = EdidSchema::DescriptorOffset + slot * EdidSchema::DescriptorSize;
+			int size = 0;
+
+			while (size < 13 && text[size] != 0)
+				++size;
+
+			for (int index = 0; index < 5; ++index)
+				data[offset + index] = 0x00;
+
+			data[offset + 3] = tag;
+
+			for (int index = 0; index < 13; ++index)
+				data[offset + 5 + index] = index < size ? text[index] : index == size ? 0x0A : 0x20;
+
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetDetailedTiming(int offset, const DetailedTiming &timing)
+		{
+			int pixelClock = timing.PixelClock / 10;
+			data[offset + 0] = pixelClock & 0xFF;
+			data[offset + 1] = pixelClock >> 8 & 0xFF;
+			data[offset + 2] = timing.HorizontalActive & 0xFF;
+			data[offset + 3] = timing.HorizontalBlanking & 0xFF;
+			data[offset + 4] = (timing.HorizontalActive >> 4 & 0xF0) | (timing.HorizontalBlanking >> 8 & 0x0F);
+			data[offset + 5] = timing.VerticalActive & 0xFF;
+			data[offset + 6] = timing.VerticalBlanking & 0xFF;
+			data[offset + 7] = (timing.VerticalActive >> 4 & 0xF0) | (timing.VerticalBlanking >> 8 & 0x0F);
+			data[offset + 8] = timing.HorizontalSyncOffset & 0xFF;
+			data[offset + 9] = timing.HorizontalSyncWidth & 0xFF;
+			data[offset + 10] = (timing.VerticalSyncOffset << 4 & 0xF0) | (timing.VerticalSyncWidth & 0x0F);
+			data[offset + 11] = (timing.HorizontalSyncOffset >> 2 & 0xC0) | (timing.HorizontalSyncWidth >> 4 & 0x30) | (timing.VerticalSyncOffset >> 2 & 0x0C) | (timing.VerticalSyncWidth >> 4 & 0x03);
+			data[offset + 12] = timing.HorizontalImageSize & 0xFF;
+			data[offset + 13] = timing.VerticalImageSize & 0xFF;
+			data[offset + 14] = (timing.HorizontalImageSize >> 4 & 0xF0) | (timing.VerticalImageSize >> 8 & 0x0F);
+			data[offset + 15] = timing.HorizontalBorder;
+			data[offset + 16] = timing.VerticalBorder;
+			data[offset + 17] = timing.Flags | (timing.Interlaced ? 0x80 : 0x00);
+			return *this;
+		}
+
+		constexpr EdidBuilder &SetExtension(int block, const unsigned char (&extension)[128])
+		{
+			for (int index = 0; index < 128; ++index)
+				data[block * 128 + index] = extension[index];
+
+			return *this;
+		}
+
+		constexpr std::array<unsigned char, Size> Build() const
+		{
+			std::array<unsigned char, Size> result = data;
+
+			for (int block = 0; block < Blocks; ++block)
+			{
+				unsigned char checksum = 0;
+
+				for (int index = block * 128; index < block * 128 + 127; ++index)
+					checksum -= result[index];
+
+				result[block * 128 + 127] = checksum;
+			}
+
+			return result;
+		}
+
+		////////////////////////////////////////////////////////////////////
+
+	private:
+
+		////////////////////////////////////////////////////////////////////
+		// Private /////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Variables ///////////////////////////////////////////////////////
+
+		std::array<unsigned char, Size> data;
+
+		////////////////////////////////////////////////////////////////////
+	};
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef EDW_EDIDSCHEMA_H
+#define EDW_EDIDSCHEMA_H
+
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW_Common.h"
+
+// Enums ///////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	enum EdidFieldType
+	{
+		EdidIntegerField,
+		EdidHexField,
+		EdidFlagField
+	};
+}
+
+// Constants ///////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	namespace EdidSchema
+	{
+		constexpr int StandardTimingOffset = 38;
+		constexpr int StandardTimingSize = 2;
+		constexpr int StandardTimingCount = 8;
+		constexpr int DescriptorOffset = 54;
+		constexpr int DescriptorSize = 18;
+		constexpr int DescriptorCount = 4;
+	}
+}
+
+// Structs /////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	template <int OffsetValue, int SizeValue, int ShiftValue, int BitsValue, unsigned MinimumValue, unsigned MaximumValue, EdidFieldType TypeValue, bool BigEndianValue = false>
+	struct EdidField
+	{
+		////////////////////////////////////////////////////////////////////
+		// Public //////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Constants ///////////////////////////////////////////////////////
+
+		static constexpr int Offset = OffsetValue;
+		static constexpr int Size = SizeValue;
+		static constexpr int Shift = ShiftValue;
+		static constexpr int Bits = BitsValue;
+		static constexpr unsigned Mask = Bits >= 32 ? 0xFFFFFFFF : (1u << Bits) - 1;
+		static constexpr unsigned Minimum = MinimumValue;
+		static constexpr unsigned Maximum = MaximumValue;
+		static constexpr EdidFieldType Type = TypeValue;
+		static constexpr bool BigEndian = BigEndianValue;
+
+		static_assert(Size >= 1 && Size <= 4, "EDID field size must be between 1 and 4 bytes");
+		static_assert(Shift + Bits <= Size * 8, "EDID field bits must fit in its bytes");
+		static_assert(Offset + Size <= 128, "EDID field must fit in the base block");
+
+		// Functions ///////////////////////////////////////////////////////
+
+		static constexpr unsigned Get(const unsigned char *data)
+		{
+			return Read(data) >> Shift & Mask;
+		}
+
+		static constexpr void Set(unsigned char *data, unsigned value)
+		{
+			Write(data, (Read(data) & ~(Mask << Shift)) | (value & Mask) << Shift);
+		}
+
+		static constexpr bool IsValid(const unsigned char *data)
+		{
+			return Get(data) >= Minimum && Get(data) <= Maximum;
+		}
+
+		////////////////////////////////////////////////////////////////////
+
+	private:
+
+		////////////////////////////////////////////////////////////////////
+		// Private /////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Functions ///////////////////////////////////////////////////////
+
+		static constexpr unsigned Read(const unsigned char *data)
+		{
+			unsigned value = 0;
+
+			for (int index = 0; index < Size; ++index)
+				value |= static_cast<unsigned>(data[Offset + (BigEndian ? Size - 1 - index : index)]) << index * 8;
+
+			return value;
+		}
+
+		static constexpr void Write(unsigned char *data, unsigned value)
+		{
+			for (int index = 0; index < Size; ++index)
+				data[Offset + (BigEndian ? Size - 1 - index : index)] = static_cast<unsigned char>(value >> index * 8);
+		}
+
+		////////////////////////////////////////////////////////////////////
+	};
+
+	template <class... Fields>
+	struct EdidFieldList
+	{
+		////////////////////////////////////////////////////////////////////
+		// Public //////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Constants ///////////////////////////////////////////////////////
+
+		static constexpr int Count = sizeof...(Fields);
+
+		// Functions ///////////////////////////////////////////////////////
+
+		static constexpr bool IsValid(const unsigned char *data)
+		{
+			return (Fields::IsValid(data) && ...);
+		}
+
+		template <class Function>
+		static void ForEach(Function &&function)
+		{
+			(function(Fields()), ...);
+		}
+
+		////////////////////////////////////////////////////////////////////
+	};
+
+	namespace EdidSchema
+	{
+		struct ManufacturerId : EdidField<8, 2, 0, 16, 0x0000, 0x7FFF, EdidHexField, true> { static const char *GetName() { return "ManufacturerId"; } };
+		template <int Letter> struct ManufacturerLetter : EdidField<8, 2, 10 - Letter * 5, 5, 1, 26, EdidIntegerField, true> { static const char *GetName() { return Letter == 0 ? "ManufacturerLetter1" : Letter == 1 ? "ManufacturerLetter2" : "ManufacturerLetter3"; } };
+		struct ProductCode : EdidField<10, 2, 0, 16, 0x0000, 0xFFFF, EdidHexField> { static const char *GetName() { return "ProductCode"; } };
+		struct SerialNumber : EdidField<12, 4, 0, 32, 0x00000000, 0xFFFFFFFF, EdidHexField> { static const char *GetName() { return "SerialNumber"; } };
+		struct Week : EdidField<16, 1, 0, 8, 0, 255, EdidIntegerField> { static const char *GetName() { return "Week"; } };
+		struct Year : EdidField<17, 1, 0, 8, 0, 255, EdidIntegerField> { static const char *GetName() { return "Year"; } };
+		struct Version : EdidField<18, 1, 0, 8, 1, 1, EdidIntegerField> { static const char *GetName() { return "Version"; } };
+		struct Revision : EdidField<19, 1, 0, 8, 0, 4, EdidIntegerField> { static const char *GetName() { return "Revision"; } };
+		struct DigitalInput : EdidField<20, 1, 7, 1, 0, 1, EdidFlagField> { static const char *GetName() { return "DigitalInput"; } };
+		struct BitDepth : EdidField<20, 1, 4, 3, 0, 7, EdidIntegerField> { static const char *GetName() { return "BitDepth"; } };
+		struct VideoInterface : EdidField<20, 1, 0, 4, 0, 5, EdidIntegerField> { static const char *GetName() { return "VideoInterface"; } };
+		struct HorizontalScreenSize : EdidField<21, 1, 0, 8, 0, 255, EdidIntegerField> { static const char *GetName() { return "HorizontalScreenSize"; } };
+		struct VerticalScreenSize : EdidField<22, 1, 0, 8, 0, 255, EdidIntegerField> { static const char *GetName() { return "VerticalScreenSize"; } };
+		struct Gamma : EdidField<23, 1, 0, 8, 0, 255, EdidIntegerField> { static const char *GetName() { return "Gamma"; } };
+		struct Standby : EdidField<24, 1, 7, 1, 0, 1, EdidFlagField> { static const char *GetName() { return "Standby"; } };
+		struct Suspend : EdidField<24, 1, 6, 1, 0, 1, EdidFlagField> { static const char *GetName() { return "Suspend"; } };
+		struct ActiveOff : EdidField<24, 1, 5, 1, 0, 1, EdidFlagField> { static const char *GetName() { return "ActiveOff"; } };
+		struct ColorType : EdidField<24, 1, 3, 2, 0, 3, EdidIntegerField> { static const char *GetName() { return "ColorType"; } };
+		struct SrgbDefault : EdidField<24, 1, 2, 1, 0, 1, EdidFlagField> { static const char *GetName() { return "SrgbDefault"; } };
+		struct PreferredTiming : EdidField<24, 1, 1, 1, 0, 1, EdidFlagField> { static const char *GetName() { return "PreferredTiming"; } };
+		struct ContinuousFrequency : EdidField<24, 1, 0, 1, 0, 1, EdidFlagField> { static const char *GetName() { return "ContinuousFrequency"; } };
+		struct RedGreenLow : EdidField<25, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "RedGreenLow"; } };
+		struct BlueWhiteLow : EdidField<26, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "BlueWhiteLow"; } };
+		struct RedX : EdidField<27, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "RedX"; } };
+		struct RedY : EdidField<28, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "RedY"; } };
+		struct GreenX : EdidField<29, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "GreenX"; } };
+		struct GreenY : EdidField<30, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "GreenY"; } };
+		struct BlueX : EdidField<31, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "BlueX"; } };
+		struct BlueY : EdidField<32, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "BlueY"; } };
+		struct WhiteX : EdidField<33, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "WhiteX"; } };
+		struct WhiteY : EdidField<34, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "WhiteY"; } };
+		struct EstablishedTimings1 : EdidField<35, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "EstablishedTimings1"; } };
+		struct EstablishedTimings2 : EdidField<36, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "EstablishedTimings2"; } };
+		struct ManufacturerTimings : EdidField<37, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "ManufacturerTimings"; } };
+		template <int Index> struct StandardTimingResolution : EdidField<StandardTimingOffset + Index * StandardTimingSize, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "StandardTimingResolution"; } };
+		template <int Index> struct StandardTimingAspectRatio : EdidField<StandardTimingOffset + Index * StandardTimingSize + 1, 1, 6, 2, 0, 3, EdidIntegerField> { static const char *GetName() { return "StandardTimingAspectRatio"; } };
+		template <int Index> struct StandardTimingRefreshRate : EdidField<StandardTimingOffset + Index * StandardTimingSize + 1, 1, 0, 6, 0, 63, EdidIntegerField> { static const char *GetName() { return "StandardTimingRefreshRate"; } };
+		template <int Slot> struct DescriptorPixelClock : EdidField<DescriptorOffset + Slot * DescriptorSize, 2, 0, 16, 0x0000, 0xFFFF, EdidIntegerField> { static const char *GetName() { return "DescriptorPixelClock"; } };
+		template <int Slot> struct DescriptorTag : EdidField<DescriptorOffset + Slot * DescriptorSize + 3, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "DescriptorTag"; } };
+		struct ExtensionCount : EdidField<126, 1, 0, 8, 0, 255, EdidIntegerField> { static const char *GetName() { return "ExtensionCount"; } };
+		struct Checksum : EdidField<127, 1, 0, 8, 0x00, 0xFF, EdidHexField> { static const char *GetName() { return "Checksum"; } };
+
+		typedef EdidFieldList<
+			ManufacturerId, ManufacturerLetter<0>, ManufacturerLetter<1>, ManufacturerLetter<2>, ProductCode, SerialNumber, Week, Year, Version, Revision,
+			DigitalInput, BitDepth, VideoInterface, HorizontalScreenSize, VerticalScreenSize, Gamma,
+			Standby, Suspend, ActiveOff, ColorType, SrgbDefault, PreferredTiming, ContinuousFrequency,
+			RedGreenLow, BlueWhiteLow, RedX, RedY, GreenX, GreenY, BlueX, BlueY, WhiteX, WhiteY,
+			EstablishedTimings1, EstablishedTimings2, ManufacturerTimings,
+			ExtensionCount, Checksum> Fields;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,272 @@
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW.h"
+
+// Implementations /////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	struct HexImpl
+	{
+		// Constants ///////////////////////////////////////////////////////
+
+		static const unsigned char InvalidDigit = 0xFF;
+		static const unsigned char SpaceClass = 1 << 0;
+		static const unsigned char PunctuationClass = 1 << 1;
+
+		// Functions ///////////////////////////////////////////////////////
+
+		constexpr HexImpl() :
+			pairs(),
+			digits(),
+			classes()
+		{
+			for (int value = 0; value < 256; ++value)
+			{
+				pairs[value * 2] = "0123456789ABCDEF"[value >> 4];
+				pairs[value * 2 + 1] = "0123456789ABCDEF"[value & 15];
+				digits[value] = InvalidDigit;
+
+				if (value >= '0' && value <= '9')
+					digits[value] = value - '0';
+				else if (value >= 'A' && value <= 'F')
+					digits[value] = value - 'A' + 10;
+				else if (value >= 'a' && value <= 'f')
+					digits[value] = value - 'a' + 10;
+
+				if (value == ' ' || (value >= '\t' && value <= '\r'))
+					classes[value] = SpaceClass;
+				else if ((value >= '!' && value <= '/') || (value >= ':' && value <= '@') || (value >= '[' && value <= '`') || (value >= '{' && value <= '~'))
+					classes[value] = PunctuationClass;
+			}
+		}
+
+		// Variables ///////////////////////////////////////////////////////
+
+		char pairs[512];
+		unsigned char digits[256];
+		unsigned char classes[256];
+
+		////////////////////////////////////////////////////////////////////
+	};
+}
+
+// Constants ///////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	constexpr HexImpl HexTable;
+}
+
+// Functions ///////////////////////////////////////////////////////////////
+
+int EDW::Hex::GetEncodedSize(int size, int columns, int offsetDigits, bool newline)
+{
+	int encodedSize = newline ? 2 : 0;
+
+	if (size <= 0)
+		return encodedSize;
+
+	int rows = columns > 0 ? (size + columns - 1) / columns : 1;
+	encodedSize += size * 2 + size - 1 + rows - 1;
+
+	if (offsetDigits > 0)
+		encodedSize += rows * (offsetDigits + 3);
+
+	return encodedSize;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+T *EDW::Hex::EncodeBuffer(T *text, const unsigned char *data, int size, int columns, int offsetDigits, bool newline)
+{
+	int column = 0;
+
+	for (int index = 0; index < size; ++index)
+	{
+		if (index > 0)
+		{
+			if (columns > 0 && column == columns)
+			{
+				*text++ = '\r';
+				*text++ = '\n';
+				column = 0;
+			}
+			else
+			{
+				*text++ = ' ';
+			}
+		}
+
+		if (column == 0 && offsetDigits > 0)
+		{
+			for (int shift = offsetDigits * 4 - 4; shift >= 0; shift -= 4)
+				*text++ = "0123456789ABCDEF"[index >> shift & 15];
+
+			*text++ = ' ';
+			*text++ = '|';
+			*text++ = ' ';
+		}
+
+		const char *pair = HexTable.pairs + data[index] * 2;
+		*text++ = pair[0];
+		*text++ = pair[1];
+		++column;
+	}
+
+	if (newline)
+	{
+		*text++ = '\r';
+		*text++ = '\n';
+	}
+
+	return text;
+}
+
+template char *EDW::Hex::EncodeBuffer(char *text, const unsigned char *data, int size, int columns, int offsetDigits, bool newline);
+template wchar_t *EDW::Hex::EncodeBuffer(wchar_t *text, const unsigned char *data, int size, int columns, int offsetDigits, bool newline);
+
+////////////////////////////////////////////////////////////////////////////
+
+template <class T>
+bool EDW::Hex::Encode(T &text, const unsigned char *data, int size, int columns, int offsetDigits, bool newline)
+{
+	text.resize(GetEncodedSize(size, columns, offsetDigits, newline));
+
+	if (text.empty())
+		return true;
+
+	return EncodeBuffer(&text[0], data, size, columns, offsetDigits, newline) == text.data() + text.size();
+}
+
+template bool EDW::Hex::Encode(std::string &text, const unsigned char *data, int size, int columns, int offsetDigits, bool newline);
+template bool EDW::Hex::Encode(std::wstring &text, const unsigned char *data, int size, int columns, int offsetDigits, bool newline);
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Hex::Decode(std::vector<unsigned char> &data, const char *text, std::size_t size)
+{
+	const unsigned char *byte = reinterpret_cast<const unsigned char *>(text);
+	const unsigned char *end = byte + size;
+	data.clear();
+	data.reserve(size / 3 + 1);
+
+	while (true)
+	{
+		while (byte < end && HexTable.classes[*byte] == HexImpl::SpaceClass)
+			++byte;
+
+		if (byte == end)
+			break;
+
+		if (end - byte < 2)
+			return false;
+
+		if (byte[0] == '0' && (byte[1] == 'x' || byte[1] == 'X'))
+		{
+			byte += 2;
+
+			if (end - byte < 2)
+				return false;
+		}
+
+		unsigned char hex1 = HexTable.digits[byte[0]];
+		unsigned char hex2 = HexTable.digits[byte[1]];
+		byte += 2;
+
+		if (hex1 == HexImpl::InvalidDigit || hex2 == HexImpl::InvalidDigit)
+			return false;
+
+		data.push_back(hex1 << 4 | hex2);
+
+		if (byte == end)
+			break;
+
+		if (HexTable.classes[*byte] == HexImpl::PunctuationClass)
+			++byte;
+	}
+
+	return !data.empty();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Hex::DecodeRows(std::vector<unsigned char> &data, const char *text, std::size_t size, int columns)
+{
+	const unsigned char *byte = reinterpret_cast<const unsigned char *>(text);
+	const unsigned char *end = byte + size;
+	data.clear();
+	data.reserve(size / 3 + 1);
+
+	for (std::size_t index = 0; ; ++index)
+	{
+		if (index % columns == 0)
+		{
+			while (byte < end && HexTable.classes[*byte] == HexImpl::SpaceClass)
+				++byte;
+
+			if (end - byte >= 3 && byte[0] == '0' && (byte[1] == 'x' || byte[1] == 'X') && HexTable.digits[byte[2]] != HexImpl::InvalidDigit)
+				byte += 2;
+
+			std::size_t offset = 0;
+			const unsigned char *begin = byte;
+
+			while (byte < end && HexTable.digits[*byte] != HexImpl::InvalidDigit)
+				offset = offset << 4 | HexTable.digits[*byte++];
+
+			if (byte == begin)
+			{
+				if (byte != end)
+					return false;
+
+				break;
+			}
+
+			if (offset != index)
+				return false;
+
+			while (byte < end && HexTable.classes[*byte] == HexImpl::SpaceClass)
+				++byte;
+
+			if (byte == end || *byte != '|')
+				return false;
+
+			++byte;
+		}
+
+		while (byte < end && HexTable.classes[*byte] == HexImpl::SpaceClass)
+			++byte;
+
+		if (byte == end)
+		{
+			if (index % columns == 0)
+				return false;
+
+			break;
+		}
+
+		if (end - byte < 2)
+			return false;
+
+		unsigned char hex1 = HexTable.digits[byte[0]];
+		unsigned char hex2 = HexTable.digits[byte[1]];
+		byte += 2;
+
+		if (hex1 == HexImpl::InvalidDigit || hex2 == HexImpl::InvalidDigit)
+			return false;
+
+		data.push_back(hex1 << 4 | hex2);
+	}
+
+	return !data.empty();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Hex::IsSpace(int value)
+{
+	return value >= 0 && value < 256 && HexTable.classes[value] == HexImpl::SpaceClass;
+}
+
+////////////////////////////////////////////////////////////////////////////
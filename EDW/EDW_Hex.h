@@ -0,0 +1,35 @@
+#ifndef EDW_HEX_H
+#define EDW_HEX_H
+
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW_Common.h"
+
+// Classes /////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	class Hex
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////////
+		// Public //////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Functions ///////////////////////////////////////////////////////
+
+		static int GetEncodedSize(int size, int columns = 0, int offsetDigits = 0, bool newline = false);
+		template <class T> static T *EncodeBuffer(T *text, const unsigned char *data, int size, int columns = 0, int offsetDigits = 0, bool newline = false);
+		template <class T> static bool Encode(T &text, const unsigned char *data, int size, int columns = 0, int offsetDigits = 0, bool newline = false);
+		static bool Decode(std::vector<unsigned char> &data, const char *text, std::size_t size);
+		static bool DecodeRows(std::vector<unsigned char> &data, const char *text, std::size_t size, int columns = 16);
+		static bool IsSpace(int value);
+
+		////////////////////////////////////////////////////////////////////
+	};
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+#endif
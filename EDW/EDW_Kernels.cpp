@@ -0,0 +1,256 @@
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW.h"
+
+// Implementations /////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	struct KernelsImpl
+	{
+		// Typedefs ////////////////////////////////////////////////////////
+
+		typedef unsigned char (*SumFunction)(const unsigned char *, int);
+		typedef bool (*IsFilledFunction)(const unsigned char *, int, unsigned char);
+		typedef bool (*IsEqualFunction)(const unsigned char *, const unsigned char *, int);
+
+		// Functions ///////////////////////////////////////////////////////
+
+		static unsigned char ScalarSum(const unsigned char *data, int size);
+		static bool ScalarIsFilled(const unsigned char *data, int size, unsigned char value);
+		static bool ScalarIsEqual(const unsigned char *data, const unsigned char *other, int size);
+		static unsigned char Sse2Sum(const unsigned char *data, int size);
+		static bool Sse2IsFilled(const unsigned char *data, int size, unsigned char value);
+		static bool Sse2IsEqual(const unsigned char *data, const unsigned char *other, int size);
+		static unsigned char Avx2Sum(const unsigned char *data, int size);
+		static bool Avx2IsFilled(const unsigned char *data, int size, unsigned char value);
+		static bool Avx2IsEqual(const unsigned char *data, const unsigned char *other, int size);
+
+		// Variables ///////////////////////////////////////////////////////
+
+		KernelSet kernelSet;
+		SumFunction sum;
+		IsFilledFunction isFilled;
+		IsEqualFunction isEqual;
+
+		static const KernelsImpl Tables[3];
+
+		////////////////////////////////////////////////////////////////////
+	};
+}
+
+// Static Variables ////////////////////////////////////////////////////////
+
+const EDW::KernelsImpl EDW::KernelsImpl::Tables[] =
+{
+	{ScalarKernels, ScalarSum, ScalarIsFilled, ScalarIsEqual},
+	{Sse2Kernels, Sse2Sum, Sse2IsFilled, Sse2IsEqual},
+	{Avx2Kernels, Avx2Sum, Avx2IsFilled, Avx2IsEqual}
+};
+
+// Functions ///////////////////////////////////////////////////////////////
+
+unsigned char EDW::KernelsImpl::ScalarSum(const unsigned char *data, int size)
+{
+	unsigned sum = 0;
+
+	for (int index = 0; index < size; ++index)
+		sum += data[index];
+
+	return static_cast<unsigned char>(sum);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::KernelsImpl::ScalarIsFilled(const unsigned char *data, int size, unsigned char value)
+{
+	for (int index = 0; index < size; ++index)
+	{
+		if (data[index] != value)
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::KernelsImpl::ScalarIsEqual(const unsigned char *data, const unsigned char *other, int size)
+{
+	return std::memcmp(data, other, size) == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+unsigned char EDW::KernelsImpl::Sse2Sum(const unsigned char *data, int size)
+{
+	__m128i zero = _mm_setzero_si128();
+	__m128i sum = _mm_setzero_si128();
+	int index = 0;
+
+	for (; index + 16 <= size; index += 16)
+		sum = _mm_add_epi64(sum, _mm_sad_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index)), zero));
+
+	unsigned total = _mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8));
+	return static_cast<unsigned char>(total + ScalarSum(data + index, size - index));
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::KernelsImpl::Sse2IsFilled(const unsigned char *data, int size, unsigned char value)
+{
+	__m128i fill = _mm_set1_epi8(static_cast<char>(value));
+	int index = 0;
+
+	for (; index + 16 <= size; index += 16)
+	{
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index)), fill)) != 0xFFFF)
+			return false;
+	}
+
+	return ScalarIsFilled(data + index, size - index, value);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::KernelsImpl::Sse2IsEqual(const unsigned char *data, const unsigned char *other, int size)
+{
+	int index = 0;
+
+	for (; index + 16 <= size; index += 16)
+	{
+		__m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index));
+		__m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(other + index));
+
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(left, right)) != 0xFFFF)
+			return false;
+	}
+
+	return ScalarIsEqual(data + index, other + index, size - index);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+unsigned char EDW::KernelsImpl::Avx2Sum(const unsigned char *data, int size)
+{
+	__m256i zero = _mm256_setzero_si256();
+	__m256i sum = _mm256_setzero_si256();
+	int index = 0;
+
+	for (; index + 32 <= size; index += 32)
+		sum = _mm256_add_epi64(sum, _mm256_sad_epu8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index)), zero));
+
+	__m128i half = _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+	unsigned total = _mm_cvtsi128_si32(half) + _mm_cvtsi128_si32(_mm_srli_si128(half, 8));
+	return static_cast<unsigned char>(total + Sse2Sum(data + index, size - index));
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::KernelsImpl::Avx2IsFilled(const unsigned char *data, int size, unsigned char value)
+{
+	__m256i fill = _mm256_set1_epi8(static_cast<char>(value));
+	int index = 0;
+
+	for (; index + 32 <= size; index += 32)
+	{
+		if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index)), fill)) != -1)
+			return false;
+	}
+
+	return Sse2IsFilled(data + index, size - index, value);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::KernelsImpl::Avx2IsEqual(const unsigned char *data, const unsigned char *other, int size)
+{
+	int index = 0;
+
+	for (; index + 32 <= size; index += 32)
+	{
+		__m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index));
+		__m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(other + index));
+
+		if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(left, right)) != -1)
+			return false;
+	}
+
+	return Sse2IsEqual(data + index, other + index, size - index);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::KernelSet EDW::Kernels::GetKernelSet()
+{
+	return GetImpl()->kernelSet;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::KernelSet EDW::Kernels::GetSupportedKernelSet()
+{
+	int info[4] = {};
+	__cpuid(info, 0);
+	int maximum = info[0];
+
+	__cpuid(info, 1);
+
+	if ((info[3] & 1 << 26) == 0)
+		return ScalarKernels;
+
+	bool osxsave = (info[2] & 1 << 27) != 0;
+	bool avx = (info[2] & 1 << 28) != 0;
+
+	if (maximum < 7 || !osxsave || !avx || (_xgetbv(0) & 6) != 6)
+		return Sse2Kernels;
+
+	__cpuidex(info, 7, 0);
+
+	if ((info[1] & 1 << 5) == 0)
+		return Sse2Kernels;
+
+	return Avx2Kernels;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Kernels::SetKernelSet(KernelSet kernelSet)
+{
+	if (kernelSet < ScalarKernels || kernelSet > GetSupportedKernelSet())
+		return false;
+
+	GetImpl() = &KernelsImpl::Tables[kernelSet];
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+unsigned char EDW::Kernels::Sum(const unsigned char *data, int size)
+{
+	return GetImpl()->sum(data, size);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Kernels::IsFilled(const unsigned char *data, int size, unsigned char value)
+{
+	return GetImpl()->isFilled(data, size, value);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Kernels::IsEqual(const unsigned char *data, const unsigned char *other, int size)
+{
+	return GetImpl()->isEqual(data, other, size);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+const EDW::KernelsImpl *&EDW::Kernels::GetImpl()
+{
+	static const KernelsImpl *impl = &KernelsImpl::Tables[GetSupportedKernelSet()];
+	return impl;
+}
+
+////////////////////////////////////////////////////////////////////////////
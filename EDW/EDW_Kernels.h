@@ -0,0 +1,59 @@
+#ifndef EDW_KERNELS_H
+#define EDW_KERNELS_H
+
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW_Common.h"
+
+// Enums ///////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	enum KernelSet
+	{
+		ScalarKernels,
+		Sse2Kernels,
+		Avx2Kernels
+	};
+}
+
+// Classes /////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	class Kernels
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////////
+		// Public //////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Functions ///////////////////////////////////////////////////////
+
+		static KernelSet GetKernelSet();
+		static KernelSet GetSupportedKernelSet();
+		static bool SetKernelSet(KernelSet kernelSet);
+		static unsigned char Sum(const unsigned char *data, int size);
+		static bool IsFilled(const unsigned char *data, int size, unsigned char value);
+		static bool IsEqual(const unsigned char *data, const unsigned char *other, int size);
+
+		////////////////////////////////////////////////////////////////////
+
+	private:
+
+		////////////////////////////////////////////////////////////////////
+		// Private /////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Functions ///////////////////////////////////////////////////////
+
+		static const struct KernelsImpl *&GetImpl();
+
+		////////////////////////////////////////////////////////////////////
+	};
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -54,7 +54,7 @@ namespace EDW
 // Static Variables ////////////////////////////////////////////////////////
 
 std::unique_ptr<EDW::Nvidia::LibraryImpl> EDW::Nvidia::Library::impl = nullptr;
-int EDW::Nvidia::Library::references = 0;
+std::atomic<int> EDW::Nvidia::Library::references(0);
 
 // Functions ///////////////////////////////////////////////////////////////
 
@@ -77,9 +77,7 @@ EDW::Nvidia::Library::Library(const Library &other)
 
 EDW::Nvidia::Library::~Library()
 {
-	--references;
-
-	if (references <= 0)
+	if (--references <= 0)
 		impl.reset();
 }
 
@@ -44,6 +44,9 @@ namespace EDW
 	namespace Nvidia
 	{
 		const NvAPI_Status NVAPI_OK = 0;
+		const NvAPI_Status NVAPI_ERROR = -1;
+		const NvAPI_Status NVAPI_TIMEOUT = -191;
+		const NvAPI_Status NVAPI_API_IN_USE = -209;
 		const int NVAPI_MAX_PHYSICAL_GPUS = 64;
 		const int NVAPI_MAX_HEADS_PER_GPU = 32;
 		const int NV_EDID_DATA_SIZE = 256;
@@ -120,7 +123,7 @@ namespace EDW
 
 		private:
 			static std::unique_ptr<struct LibraryImpl> impl;
-			static int references;
+			static std::atomic<int> references;
 		};
 	}
 }
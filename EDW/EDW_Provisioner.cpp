@@ -0,0 +1,358 @@
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW.h"
+
+// Implementation //////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	struct ProvisionerImpl
+	{
+		// Functions ///////////////////////////////////////////////////////
+
+		ProvisionerImpl();
+
+		static std::unique_ptr<ProvisionerImpl> Create();
+		std::unique_ptr<ProvisionerImpl> Clone() const;
+
+		bool GroupBuses(std::vector<std::vector<int>> &buses);
+		bool RunBus(const std::vector<int> &bus, std::chrono::steady_clock::time_point start);
+		bool RunJob(int index, std::chrono::steady_clock::time_point start);
+		bool ExecuteJob(int index, std::chrono::steady_clock::time_point start);
+
+		static bool AddRetries(ProvisionResult &result, const RetryStatistics &oldStatistics, const RetryStatistics &newStatistics);
+		static long long GetMicroseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+
+		// Variables ///////////////////////////////////////////////////////
+
+		std::vector<ProvisionJob> jobs;
+		std::vector<ProvisionResult> results;
+		int workerCount;
+		int busCount;
+		long long duration;
+
+		////////////////////////////////////////////////////////////////////
+	};
+}
+
+// Functions ///////////////////////////////////////////////////////////////
+
+EDW::Provisioner::Provisioner() :
+	impl(ProvisionerImpl::Create())
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::Provisioner::Provisioner(const Provisioner &other) :
+	impl(other.impl ? other.impl->Clone() : nullptr)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::Provisioner &EDW::Provisioner::operator=(const Provisioner &other)
+{
+	impl = other.impl ? other.impl->Clone() : nullptr;
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::Provisioner::~Provisioner() = default;
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::Provisioner::operator bool() const
+{
+	return impl.get();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Provisioner::Add(const Display &display, const DisplayData &displayData, ProvisionTarget target)
+{
+	if (!display || !displayData)
+		return false;
+
+	impl->jobs.push_back({display, displayData, target});
+	impl->jobs.back().Output.Detach();
+	impl->results.push_back({ProvisionStatus::Pending, WriteError::None, 0, 0, 0, 0, 0, 0});
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Provisioner::Clear()
+{
+	impl->jobs.clear();
+	impl->results.clear();
+	impl->busCount = 0;
+	impl->duration = 0;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+int EDW::Provisioner::GetCount() const
+{
+	return static_cast<int>(impl->jobs.size());
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Provisioner::IsValidIndex(int index) const
+{
+	return index >= 0 && index < GetCount();
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Provisioner::GetJob(int index, ProvisionJob &job) const
+{
+	if (!IsValidIndex(index))
+		return false;
+
+	job = impl->jobs[index];
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Provisioner::GetResult(int index, ProvisionResult &result) const
+{
+	if (!IsValidIndex(index))
+		return false;
+
+	result = impl->results[index];
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+int EDW::Provisioner::GetWorkerCount() const
+{
+	return impl->workerCount;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Provisioner::SetWorkerCount(int workerCount)
+{
+	if (workerCount < 0)
+		return false;
+
+	impl->workerCount = workerCount;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+int EDW::Provisioner::GetBusCount() const
+{
+	return impl->busCount;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+long long EDW::Provisioner::GetDuration() const
+{
+	return impl->duration;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::Provisioner::Run()
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::vector<std::vector<int>> buses;
+	impl->GroupBuses(buses);
+
+	for (ProvisionResult &result : impl->results)
+		result = {ProvisionStatus::Pending, WriteError::None, 0, 0, 0, 0, 0, 0};
+
+	int workerCount = impl->busCount;
+
+	if (impl->workerCount > 0 && impl->workerCount < workerCount)
+		workerCount = impl->workerCount;
+
+	std::atomic<int> nextBus(0);
+	std::atomic<bool> status(true);
+
+	auto worker = [&]()
+	{
+		for (int bus = nextBus++; bus < impl->busCount; bus = nextBus++)
+		{
+			if (!impl->RunBus(buses[bus], start))
+				status = false;
+		}
+	};
+
+	std::vector<std::thread> threads;
+
+	for (int index = 1; index < workerCount; ++index)
+		threads.emplace_back(worker);
+
+	worker();
+
+	for (std::thread &thread : threads)
+		thread.join();
+
+	impl->duration = ProvisionerImpl::GetMicroseconds(start, std::chrono::steady_clock::now());
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+EDW::ProvisionerImpl::ProvisionerImpl() :
+	workerCount(0),
+	busCount(0),
+	duration(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<EDW::ProvisionerImpl> EDW::ProvisionerImpl::Create()
+{
+	std::unique_ptr<ProvisionerImpl> impl(new ProvisionerImpl);
+	return impl;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<EDW::ProvisionerImpl> EDW::ProvisionerImpl::Clone() const
+{
+	std::unique_ptr<ProvisionerImpl> impl(new ProvisionerImpl(*this));
+
+	for (ProvisionJob &job : impl->jobs)
+		job.Output.Detach();
+
+	return impl;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::ProvisionerImpl::GroupBuses(std::vector<std::vector<int>> &buses)
+{
+	std::map<std::string, int> busIndex;
+	buses.clear();
+
+	for (int index = 0; index < static_cast<int>(jobs.size()); ++index)
+	{
+		std::string identity;
+		jobs[index].Output.GetBusIdentity(identity);
+		auto bus = busIndex.emplace(identity, static_cast<int>(buses.size()));
+
+		if (bus.second)
+			buses.emplace_back();
+
+		buses[bus.first->second].push_back(index);
+	}
+
+	busCount = static_cast<int>(buses.size());
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::ProvisionerImpl::RunBus(const std::vector<int> &bus, std::chrono::steady_clock::time_point start)
+{
+	bool status = true;
+
+	for (int index : bus)
+	{
+		if (!RunJob(index, start))
+			status = false;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::ProvisionerImpl::RunJob(int index, std::chrono::steady_clock::time_point start)
+{
+	RetryStatistics oldStatistics;
+	jobs[index].Output.GetRetryStatistics(oldStatistics);
+	bool status = ExecuteJob(index, start);
+
+	RetryStatistics newStatistics;
+	jobs[index].Output.GetRetryStatistics(newStatistics);
+	AddRetries(results[index], oldStatistics, newStatistics);
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::ProvisionerImpl::ExecuteJob(int index, std::chrono::steady_clock::time_point start)
+{
+	ProvisionJob &job = jobs[index];
+	ProvisionResult &result = results[index];
+	bool edid = job.Target == ProvisionTarget::Edid;
+
+	std::chrono::steady_clock::time_point readStart = std::chrono::steady_clock::now();
+	result.WaitTime = GetMicroseconds(start, readStart);
+
+	DisplayData oldData;
+	bool read = edid ? job.Output.ReadEdid(oldData) : job.Output.ReadDisplayId(oldData);
+
+	std::chrono::steady_clock::time_point writeStart = std::chrono::steady_clock::now();
+	result.ReadTime = GetMicroseconds(readStart, writeStart);
+
+	if (!read)
+	{
+		result.Status = ProvisionStatus::ReadFailed;
+		result.Error = WriteError::Communication;
+		return false;
+	}
+
+	if (oldData == job.Data)
+	{
+		result.Status = ProvisionStatus::Unchanged;
+		return true;
+	}
+
+	WritePlan plan;
+
+	if (!Display::CreateWritePlan(oldData, job.Data, job.Output.GetPageSize(), plan))
+	{
+		result.Status = ProvisionStatus::WriteFailed;
+		return false;
+	}
+
+	result.Transactions = static_cast<int>(plan.Transactions.size());
+	bool written = edid ? job.Output.WriteEdid(job.Data, plan) : job.Output.WriteDisplayId(job.Data, plan);
+	result.WriteTime = GetMicroseconds(writeStart, std::chrono::steady_clock::now());
+
+	if (!written)
+	{
+		result.Status = ProvisionStatus::WriteFailed;
+		result.Error = job.Output.GetWriteError();
+		return false;
+	}
+
+	result.Status = ProvisionStatus::Written;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+bool EDW::ProvisionerImpl::AddRetries(ProvisionResult &result, const RetryStatistics &oldStatistics, const RetryStatistics &newStatistics)
+{
+	result.Retries = newStatistics.BusyRetries - oldStatistics.BusyRetries;
+	result.Retries += newStatistics.TimeoutRetries - oldStatistics.TimeoutRetries;
+	result.Retries += newStatistics.DriverRetries - oldStatistics.DriverRetries;
+	result.Retries += newStatistics.MismatchRetries - oldStatistics.MismatchRetries;
+	result.WastedTime = newStatistics.WastedTime - oldStatistics.WastedTime;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+long long EDW::ProvisionerImpl::GetMicroseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,96 @@
+#ifndef EDW_PROVISIONER_H
+#define EDW_PROVISIONER_H
+
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW_Display.h"
+#include "EDW_DisplayData.h"
+#include "EDW_Common.h"
+
+// Enums ///////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	enum class ProvisionTarget
+	{
+		Edid,
+		DisplayId
+	};
+
+	enum class ProvisionStatus
+	{
+		Pending,
+		Unchanged,
+		Written,
+		ReadFailed,
+		WriteFailed
+	};
+}
+
+// Structs /////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	struct ProvisionJob
+	{
+		Display Output;
+		DisplayData Data;
+		ProvisionTarget Target;
+	};
+
+	struct ProvisionResult
+	{
+		ProvisionStatus Status;
+		WriteError Error;
+		int Transactions;
+		long long WaitTime;
+		long long ReadTime;
+		long long WriteTime;
+		int Retries;
+		long long WastedTime;
+	};
+}
+
+// Classes /////////////////////////////////////////////////////////////////
+
+namespace EDW
+{
+	class Provisioner
+	{
+	public:
+
+		////////////////////////////////////////////////////////////////////
+		// Public //////////////////////////////////////////////////////////
+		////////////////////////////////////////////////////////////////////
+
+		// Functions ///////////////////////////////////////////////////////
+
+		Provisioner();
+		Provisioner(const Provisioner &other);
+		Provisioner &operator=(const Provisioner &other);
+		~Provisioner();
+
+		explicit operator bool() const;
+
+		bool Add(const Display &display, const DisplayData &displayData, ProvisionTarget target = ProvisionTarget::Edid);
+		bool Clear();
+		int GetCount() const;
+		bool IsValidIndex(int index) const;
+		bool GetJob(int index, ProvisionJob &job) const;
+		bool GetResult(int index, ProvisionResult &result) const;
+		int GetWorkerCount() const;
+		bool SetWorkerCount(int workerCount);
+		int GetBusCount() const;
+		long long GetDuration() const;
+		bool Run();
+
+		////////////////////////////////////////////////////////////////////
+
+	private:
+		std::unique_ptr<struct ProvisionerImpl> impl;
+	};
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -556,26 +556,14 @@ void MainWindow::WriteEdidButtonClick()
 		SetCursor(LoadCursorW(nullptr, IDC_WAIT));
 
 		if (!display.WriteEdid(displayData))
-			throw L"Failed to write data.";
-
-		EDW::DisplayData newDisplayData;
-
-		if (!display.ReadEdid(newDisplayData))
-			throw L"Failed to read data.";
-
-		if (newDisplayData == oldDisplayData)
-			throw L"Display is write-protected.";
-
-		if (newDisplayData != displayData)
 		{
-			if (!display.WriteEdid(displayData, false))
-				throw L"Failed to write data.";
-
-			if (!display.ReadEdid(newDisplayData))
-				throw L"Failed to read data.";
+			if (display.GetWriteError() == EDW::WriteError::WriteProtected)
+				throw L"Display is write-protected.";
 
-			if (newDisplayData != displayData)
+			if (display.GetWriteError() == EDW::WriteError::Verification)
 				throw L"Failed to verify data.";
+
+			throw L"Failed to write data.";
 		}
 
 		displayList.Set(displayIndex, display);
@@ -630,26 +618,14 @@ void MainWindow::WriteDisplayIdButtonClick()
 		SetCursor(LoadCursorW(nullptr, IDC_WAIT));
 
 		if (!display.WriteDisplayId(displayData))
-			throw L"Failed to write data.";
-
-		EDW::DisplayData newDisplayData;
-
-		if (!display.ReadDisplayId(newDisplayData))
-			throw L"Failed to read data.";
-
-		if (newDisplayData == oldDisplayData)
-			throw L"Display is write-protected.";
-
-		if (newDisplayData != displayData)
 		{
-			if (!display.WriteDisplayId(displayData, false))
-				throw L"Failed to write data.";
-
-			if (!display.ReadDisplayId(newDisplayData))
-				throw L"Failed to read data.";
+			if (display.GetWriteError() == EDW::WriteError::WriteProtected)
+				throw L"Display is write-protected.";
 
-			if (newDisplayData != displayData)
+			if (display.GetWriteError() == EDW::WriteError::Verification)
 				throw L"Failed to verify data.";
+
+			throw L"Failed to write data.";
 		}
 
 		MessageBoxW(GetHandle(), L"Data written successfully.", L"Write DisplayID", 0);
@@ -0,0 +1,819 @@
+// Includes ////////////////////////////////////////////////////////////////
+
+#include "EDW.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+// Functions ///////////////////////////////////////////////////////////////
+
+static EDW::DisplayData CreateEdid(int extensions)
+{
+	std::basic_string<unsigned char> data(128 + extensions * 128, 0x00);
+	std::copy(std::begin(EDW::DisplayDataView::EdidHeader), std::end(EDW::DisplayDataView::EdidHeader), data.begin());
+	data[18] = 0x01;
+	data[19] = 0x04;
+	data[126] = static_cast<unsigned char>(extensions);
+
+	for (int block = 1; block <= extensions; ++block)
+	{
+		data[block * 128] = 0x02;
+		data[block * 128 + 1] = 0x03;
+		data[block * 128 + 2] = 0x04;
+
+		for (int index = 4; index < 127; ++index)
+			data[block * 128 + index] = static_cast<unsigned char>(block * 16 + index);
+	}
+
+	EDW::DisplayData displayData(data);
+	displayData.FixEdidChecksums();
+	return displayData;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static EDW::DisplayData CreateDisplayId()
+{
+	std::basic_string<unsigned char> data(128, 0x00);
+	data[0] = 0x12;
+	data[1] = 123;
+	data[6] = 120;
+
+	for (int index = 7; index < 127; ++index)
+		data[index] = static_cast<unsigned char>(index);
+
+	EDW::DisplayData displayData(data);
+	displayData.FixDisplayIdChecksums();
+	return displayData;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestSetRange()
+{
+	EDW::DisplayData edid = CreateEdid(2);
+	EDW::DisplayData displayId = CreateDisplayId();
+	unsigned char data[64];
+
+	for (int index = 0; index < 64; ++index)
+		data[index] = static_cast<unsigned char>(index * 7);
+
+	if (!edid.SetRange(40, data, 64) || !edid.SetRange(300, data, 64) || !edid.IsValidEdidChecksums())
+		return false;
+
+	if (!displayId.SetRange(40, data, 64) || !displayId.SetByte(1, 100) || !displayId.IsValidDisplayIdChecksums())
+		return false;
+
+	return edid.IsDirtyLine(5) && edid.IsDirtyLine(15) && edid.IsDirtyLine(47) && !edid.IsDirtyLine(14);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestKernels(EDW::KernelSet kernelSet)
+{
+	unsigned char data[320];
+	unsigned char other[320];
+	unsigned char filled[320];
+
+	for (int index = 0; index < 320; ++index)
+		data[index] = static_cast<unsigned char>(index * 73 + 41);
+
+	for (int offset = 0; offset < 4; ++offset)
+	{
+		for (int size = 0; size <= 300; ++size)
+		{
+			unsigned sum = 0;
+
+			for (int index = 0; index < size; ++index)
+				sum += data[offset + index];
+
+			if (EDW::Kernels::Sum(data + offset, size) != static_cast<unsigned char>(sum))
+				return false;
+
+			std::fill(std::begin(filled), std::end(filled), 0x5A);
+			std::copy(std::begin(data), std::end(data), std::begin(other));
+
+			if (!EDW::Kernels::IsFilled(filled + offset, size, 0x5A) || !EDW::Kernels::IsEqual(data + offset, other + offset, size))
+				return false;
+
+			for (int position : {0, size / 2, size - 1})
+			{
+				if (position < 0 || position >= size)
+					continue;
+
+				filled[offset + position] ^= 0x01;
+				other[offset + position] ^= 0x80;
+
+				if (EDW::Kernels::IsFilled(filled + offset, size, 0x5A) || EDW::Kernels::IsEqual(data + offset, other + offset, size))
+					return false;
+
+				filled[offset + position] ^= 0x01;
+				other[offset + position] ^= 0x80;
+			}
+
+			filled[offset + size] ^= 0x01;
+			other[offset + size] ^= 0x80;
+
+			if (!EDW::Kernels::IsFilled(filled + offset, size, 0x5A) || !EDW::Kernels::IsEqual(data + offset, other + offset, size))
+				return false;
+		}
+	}
+
+	return EDW::Kernels::GetKernelSet() == kernelSet;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestKernels()
+{
+	EDW::KernelSet kernelSet = EDW::Kernels::GetKernelSet();
+	bool status = true;
+
+	for (int index = EDW::ScalarKernels; index <= EDW::Kernels::GetSupportedKernelSet(); ++index)
+	{
+		if (!EDW::Kernels::SetKernelSet(static_cast<EDW::KernelSet>(index)) || !TestKernels(static_cast<EDW::KernelSet>(index)))
+			status = false;
+	}
+
+	EDW::Kernels::SetKernelSet(kernelSet);
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestHexDecode()
+{
+	const std::vector<unsigned char> expected = {0x00, 0xFF, 0x10, 0x7F};
+	const char *valid[] = {"00 FF 10 7F", "00,FF,10,7F", "0x00, 0xFF,\t0x10,\r\n0X7f", "00:ff:10:7f;", "00FF107F", "  00-FF-10-7F\r\n"};
+	const char *invalid[] = {"", " \r\n", "0G", "00 F", "00,,FF", "0x"};
+	std::vector<unsigned char> data;
+
+	for (const char *text : valid)
+	{
+		if (!EDW::Hex::Decode(data, text, std::strlen(text)) || data != expected)
+			return false;
+	}
+
+	for (const char *text : invalid)
+	{
+		if (EDW::Hex::Decode(data, text, std::strlen(text)))
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestHexDecodeRows()
+{
+	unsigned char bytes[40];
+
+	for (int index = 0; index < 40; ++index)
+		bytes[index] = static_cast<unsigned char>(index * 13);
+
+	std::string text;
+	std::vector<unsigned char> data;
+
+	if (!EDW::Hex::Encode(text, bytes, 40, 16, 2, true) || !EDW::Hex::DecodeRows(data, text.data(), text.size()))
+		return false;
+
+	if (data != std::vector<unsigned char>(bytes, bytes + 40))
+		return false;
+
+	const char *valid = "0x00 | 00 01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F\n0x10|10 11\n";
+	const char *invalid[] = {"00 | 00 01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F\r\n20 | 10 11", "00 00 01", "00 | 0G", "00 |"};
+
+	if (!EDW::Hex::DecodeRows(data, valid, std::strlen(valid)) || data.size() != 18 || data[17] != 0x11)
+		return false;
+
+	for (const char *text : invalid)
+	{
+		if (EDW::Hex::DecodeRows(data, text, std::strlen(text)))
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestLoadFormats()
+{
+	EDW::DisplayData edid = CreateEdid(3);
+	EDW::DisplayData displayData[4];
+	std::string files[4] = {"Tests.bin", "Tests.dat", "Tests.txt", "Tests.raw.txt"};
+	bool saved = edid.SaveBin(files[0]) && edid.SaveDat(files[1]) && edid.SaveTxt(files[2]) && edid.SaveTxt(files[3], 0);
+	bool status = saved;
+
+	for (int index = 0; index < 4; ++index)
+	{
+		if (saved && (!displayData[index].Load(files[index]) || displayData[index] != edid || displayData[index].GetSize() != edid.GetSize()))
+			status = false;
+
+		std::remove(files[index].c_str());
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestReadSegment()
+{
+	EDW::DisplayData edid = CreateEdid(3);
+	EDW::Display display = EDW::Display::CreateSimulated(edid);
+	EDW::DisplayData displayData;
+
+	if (!display || !display.ReadEdid(displayData))
+		return false;
+
+	return displayData.GetSize() == 512 && displayData == edid;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestReadRange()
+{
+	EDW::DisplayData edid = CreateEdid(3);
+	EDW::Display display = EDW::Display::CreateSimulated(edid, EDW::DisplayData(), 0, false, 400, true, 32);
+	std::basic_string<unsigned char> data;
+	std::vector<EDW::I2CTransaction> transactions;
+
+	if (!display || !display.ClearTransactions() || !display.ReadRange(0xA0, 200, 160, data) || !display.GetTransactions(transactions))
+		return false;
+
+	if (data.size() != 160 || std::memcmp(data.data(), edid.GetView().GetData() + 200, 160) != 0)
+		return false;
+
+	int size = 0;
+
+	for (const EDW::I2CTransaction &transaction : transactions)
+	{
+		if (transaction.Address != 0xA1 || !transaction.Success)
+			continue;
+
+		if (transaction.Size > 32)
+			return false;
+
+		size += transaction.Size;
+	}
+
+	return size == 160;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestTransfer()
+{
+	EDW::DisplayData edid = CreateEdid(3);
+	EDW::Display display = EDW::Display::CreateSimulated(edid, EDW::DisplayData(), 2000);
+	unsigned char segment = 1;
+	unsigned char offset = 0;
+	unsigned char block[128];
+	EDW::I2COperation reads[] = {{0x60, &segment, 1, nullptr, 0}, {0xA0, &offset, 1, block, 128}};
+
+	if (!display || !display.Transfer(reads, 2) || std::memcmp(block, edid.GetView().GetData() + 256, 128) != 0)
+		return false;
+
+	unsigned char command[] = {16, 0x5A};
+	unsigned char readOffset = 16;
+	unsigned char data = 0;
+	EDW::I2COperation writes[] = {{0xA0, command, 2, nullptr, 0}, {0xA0, &readOffset, 1, &data, 1}};
+
+	if (!display.Transfer(writes, 2) || data != 0x5A)
+		return false;
+
+	return !display.Transfer(reads, 1) && display.GetBusError() == EDW::BusError::Driver;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestNegotiateBusSpeed()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	static const int Speeds[] = {400, 100, 33};
+
+	for (int speed : Speeds)
+	{
+		EDW::Display display = EDW::Display::CreateSimulated(edid, EDW::DisplayData(), 0, false, speed);
+
+		if (!display || !display.NegotiateBusSpeed() || display.GetBusSpeed() != speed)
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestStepDownBusSpeed()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	EDW::Display display = EDW::Display::CreateSimulated(edid, EDW::DisplayData(), 0, false, 100);
+	unsigned char command[] = {16, 0x5A, 0xA5};
+	EDW::I2COperation write = {0xA0, command, 3, nullptr, 0};
+
+	if (!display || !display.SetBusSpeed(400))
+		return false;
+
+	EDW::BusStatistics oldStatistics;
+	display.GetBusStatistics(oldStatistics);
+
+	for (int error = 0; error < 3; ++error)
+	{
+		if (display.GetBusSpeed() != 400 || display.Transfer(&write, 1))
+			return false;
+	}
+
+	EDW::BusStatistics newStatistics;
+	display.GetBusStatistics(newStatistics);
+
+	if (display.GetBusSpeed() != 100 || newStatistics.StepDowns != oldStatistics.StepDowns + 1 || newStatistics.Errors != oldStatistics.Errors + 3)
+		return false;
+
+	return display.Transfer(&write, 1);
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestRetryPolicy()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	EDW::Display display = EDW::Display::CreateSimulated(edid);
+	EDW::RetryPolicy policy;
+
+	if (!display || !display.GetRetryPolicy(policy))
+		return false;
+
+	EDW::RetryPolicy invalidPolicy = policy;
+	invalidPolicy.Busy.MaxBackoff = invalidPolicy.Busy.Backoff - 1;
+
+	if (display.SetRetryPolicy(invalidPolicy))
+		return false;
+
+	invalidPolicy = policy;
+	invalidPolicy.Jitter = 101;
+
+	if (display.SetRetryPolicy(invalidPolicy))
+		return false;
+
+	policy.Busy = {2, 100, 100};
+	policy.Jitter = 0;
+
+	EDW::RetryStatistics oldStatistics;
+	std::basic_string<unsigned char> data;
+
+	if (!display.SetRetryPolicy(policy) || !display.GetRetryStatistics(oldStatistics) || display.ReadRange(0xA4, 0, 16, data))
+		return false;
+
+	EDW::RetryStatistics newStatistics;
+	display.GetRetryStatistics(newStatistics);
+
+	return display.GetBusError() == EDW::BusError::Busy && newStatistics.BusyRetries == oldStatistics.BusyRetries + 2 && newStatistics.Failures == oldStatistics.Failures + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestAckPolling()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	EDW::Display display = EDW::Display::CreateSimulated(edid, EDW::DisplayData(), 5000);
+	EDW::DisplayData newEdid = edid;
+	newEdid.SetByte(16, 0x5A);
+	newEdid.SetByte(80, 0xA5);
+	newEdid.FixEdidChecksums();
+	std::vector<EDW::I2CTransaction> transactions;
+
+	if (!display || !display.ClearTransactions() || !display.WriteEdid(newEdid) || !display.GetTransactions(transactions))
+		return false;
+
+	int busy = 0;
+	int ready = 0;
+
+	for (const EDW::I2CTransaction &transaction : transactions)
+	{
+		if (transaction.Read || transaction.Size != 0)
+			continue;
+
+		if (transaction.Success)
+			++ready;
+		else
+			++busy;
+	}
+
+	if (busy < 1 || ready < 1 || !display.GetAckPolling())
+		return false;
+
+	if (!display.SetAckPolling(false) || !display.ClearTransactions() || !display.WriteEdid(edid) || !display.GetTransactions(transactions))
+		return false;
+
+	for (const EDW::I2CTransaction &transaction : transactions)
+	{
+		if (!transaction.Read && transaction.Size == 0)
+			return false;
+	}
+
+	EDW::DisplayData displayData;
+	return display.ReadEdid(displayData) && displayData == edid;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestWritePlan()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	EDW::DisplayData newEdid = edid;
+	newEdid.SetByte(17, 0x11);
+	newEdid.SetByte(20, 0x22);
+	newEdid.SetByte(130, 0x05);
+	newEdid.FixEdidChecksums();
+
+	EDW::WritePlan plan;
+
+	if (!EDW::Display::CreateWritePlan(edid, newEdid, 8, plan) || plan.PageSize != 8 || plan.Transactions.size() != 4)
+		return false;
+
+	static const EDW::WriteTransaction Transactions[] = {{255, 1}, {130, 1}, {127, 1}, {17, 4}};
+
+	for (std::size_t index = 0; index < plan.Transactions.size(); ++index)
+	{
+		const EDW::WriteTransaction &transaction = plan.Transactions[index];
+
+		if (transaction.Offset != Transactions[index].Offset || transaction.Size != Transactions[index].Size)
+			return false;
+
+		if (transaction.Offset / plan.PageSize != (transaction.Offset + transaction.Size - 1) / plan.PageSize)
+			return false;
+	}
+
+	if (EDW::Display::CreateWritePlan(edid, newEdid, 12, plan) || !EDW::Display::CreateWritePlan(edid, edid, 8, plan) || !plan.Transactions.empty())
+		return false;
+
+	EDW::Display display = EDW::Display::CreateSimulated(edid);
+	EDW::DisplayData displayData;
+
+	if (!display || !EDW::Display::CreateWritePlan(edid, newEdid, 16, plan) || !display.WriteEdid(newEdid, plan))
+		return false;
+
+	return display.ReadEdid(displayData) && displayData == newEdid;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestJournal()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	EDW::Display display = EDW::Display::CreateSimulated(edid);
+	EDW::DisplayData newEdid = edid;
+	newEdid.SetByte(16, 0x5A);
+	newEdid.SetByte(80, 0xA5);
+	newEdid.FixEdidChecksums();
+
+	EDW::DisplayData partialEdid = edid;
+	partialEdid.SetByte(80, 0xA5);
+	partialEdid.SetByte(127, newEdid.GetView().GetData()[127]);
+
+	EDW::Display interrupted = display;
+	std::string identity;
+
+	if (!display || !interrupted.WriteEdid(partialEdid) || !display.GetBusIdentity(identity))
+		return false;
+
+	std::basic_string<unsigned char> data;
+	std::string hex;
+	newEdid.GetData(data);
+	EDW::Hex::Encode(hex, data.data(), static_cast<int>(data.size()));
+
+	std::ofstream stream("Journal.tmp", std::ios::binary);
+	stream << "EDW JOURNAL 1\n" << identity << "\n160\n\n" << hex << "\n8 3\n127 1\n80 1\n16 1\n0\n1\n";
+	stream.close();
+
+	std::vector<EDW::I2CTransaction> transactions;
+
+	if (!stream || !display.SetJournal(L"Journal.tmp") || !display.ClearTransactions() || !display.WriteEdid(newEdid) || !display.GetTransactions(transactions))
+		return false;
+
+	int writes = 0;
+
+	for (const EDW::I2CTransaction &transaction : transactions)
+	{
+		if (!transaction.Read && transaction.Size > 1)
+			++writes;
+	}
+
+	EDW::DisplayData displayData;
+
+	if (writes != 2 || std::ifstream("Journal.tmp"))
+		return false;
+
+	return display.ReadEdid(displayData) && displayData == newEdid;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestWriteProtected()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	EDW::Display display = EDW::Display::CreateSimulated(edid, EDW::DisplayData(), 0, true);
+	EDW::DisplayData newEdid = edid;
+	newEdid.SetByte(16, 0x5A);
+	newEdid.SetByte(80, 0xA5);
+	newEdid.FixEdidChecksums();
+	std::vector<EDW::I2CTransaction> transactions;
+
+	if (!display || !display.ClearTransactions() || display.WriteEdid(newEdid) || display.GetWriteError() != EDW::WriteError::WriteProtected || !display.GetTransactions(transactions))
+		return false;
+
+	int writes = 0;
+
+	for (const EDW::I2CTransaction &transaction : transactions)
+	{
+		if (!transaction.Read && transaction.Size > 1)
+			++writes;
+	}
+
+	EDW::DisplayData displayData;
+
+	if (writes != 1 || !display.ReadEdid(displayData) || displayData != edid)
+		return false;
+
+	EDW::Display writable = EDW::Display::CreateSimulated(edid);
+	return writable && writable.WriteEdid(newEdid) && writable.GetWriteError() == EDW::WriteError::None;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestVerifyChecksums()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	EDW::Display display = EDW::Display::CreateSimulated(edid, EDW::DisplayData(), 0, false, 400, true, 256, 3);
+	EDW::DisplayData newEdid = edid;
+
+	for (int offset = 40; offset < 104; ++offset)
+		newEdid.SetByte(offset, offset % 2 == 0 ? 0x01 : 0xFF);
+
+	if (!display || !display.SetWriteVerification(EDW::WriteVerification::Checksums) || !display.WriteEdid(newEdid))
+		return false;
+
+	EDW::RetryStatistics statistics;
+	EDW::DisplayData displayData;
+
+	if (!display.GetRetryStatistics(statistics) || statistics.MismatchRetries != 1)
+		return false;
+
+	return display.ReadEdid(displayData) && displayData == newEdid;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestWriteSegment()
+{
+	EDW::DisplayData edid = CreateEdid(3);
+	EDW::Display display = EDW::Display::CreateSimulated(edid);
+	EDW::DisplayData newEdid = edid;
+	newEdid.SetByte(256 + 16, 0x5A);
+	newEdid.SetByte(384 + 32, 0xA5);
+
+	if (!display || !display.WriteEdid(newEdid, true))
+		return false;
+
+	EDW::DisplayData displayData;
+
+	if (!display.ReadEdid(displayData))
+		return false;
+
+	return displayData == newEdid && displayData.GetView().GetData()[16] == edid.GetView().GetData()[16];
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestSegmentWire()
+{
+	EDW::DisplayData edid = CreateEdid(3);
+	EDW::Display display = EDW::Display::CreateSimulated(edid);
+	EDW::DisplayData displayData;
+	std::vector<EDW::I2CTransaction> transactions;
+
+	if (!display || !display.ClearTransactions() || !display.ReadEdid(displayData) || !display.GetTransactions(transactions))
+		return false;
+
+	int segments = 0;
+
+	for (std::size_t index = 0; index < transactions.size(); ++index)
+	{
+		if (transactions[index].Address == 0xA0 && transactions[index].Size != 1)
+			return false;
+
+		if (transactions[index].Address != 0x60)
+			continue;
+
+		if (transactions[index].Size != 1 || index + 2 >= transactions.size())
+			return false;
+
+		if (transactions[index + 1].Address != 0xA0 || transactions[index + 1].Read || transactions[index + 2].Address != 0xA1 || !transactions[index + 2].Read)
+			return false;
+
+		++segments;
+	}
+
+	if (displayData != edid || segments < 1)
+		return false;
+
+	EDW::Display legacy = EDW::Display::CreateSimulated(edid, EDW::DisplayData(), 0, false, 400, false);
+
+	if (!legacy || !legacy.ClearTransactions() || !legacy.ReadEdid(displayData) || !legacy.GetTransactions(transactions))
+		return false;
+
+	if (displayData.GetSize() != 256 || legacy.GetBusError() != EDW::BusError::Driver)
+		return false;
+
+	for (const EDW::I2CTransaction &transaction : transactions)
+	{
+		if (transaction.Address == 0x60)
+			return false;
+	}
+
+	EDW::DisplayData newEdid = edid;
+	newEdid.SetByte(384 + 16, 0x5A);
+
+	if (!legacy.ClearTransactions() || legacy.WriteEdid(newEdid) || legacy.GetWriteError() != EDW::WriteError::Communication || !legacy.GetTransactions(transactions))
+		return false;
+
+	for (const EDW::I2CTransaction &transaction : transactions)
+	{
+		if (!transaction.Read)
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestSegmentReset()
+{
+	EDW::DisplayData edid = CreateEdid(3);
+	EDW::Display display = EDW::Display::CreateSimulated(edid);
+	unsigned char segment = 1;
+	unsigned char offset = 16;
+	unsigned char data = 0;
+
+	EDW::I2COperation segmentOperation = {0x60, &segment, 1, nullptr, 0};
+	EDW::I2COperation readOperation = {0xA0, &offset, 1, &data, 1};
+
+	if (!display || display.Transfer(&segmentOperation, 1))
+		return false;
+
+	if (!display.Transfer(&readOperation, 1))
+		return false;
+
+	return data == edid.GetView().GetData()[16];
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestStableInvalidData()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	std::basic_string<unsigned char> data;
+	edid.GetData(data);
+	data[127] ^= 0xFF;
+
+	EDW::Display display = EDW::Display::CreateSimulated(EDW::DisplayData(data));
+	display.SetBusSpeed(400);
+	EDW::DisplayData displayData;
+
+	if (!display || !display.ReadEdid(displayData))
+		return false;
+
+	EDW::BusStatistics busStatistics;
+	EDW::RetryStatistics retryStatistics;
+	display.GetBusStatistics(busStatistics);
+	display.GetRetryStatistics(retryStatistics);
+	return displayData == EDW::DisplayData(data) && display.GetBusSpeed() == 400 && busStatistics.StepDowns == 0 && retryStatistics.MismatchRetries == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////
+
+static bool TestProvisioner()
+{
+	EDW::DisplayData edid = CreateEdid(1);
+	EDW::DisplayData displayId = CreateDisplayId();
+	EDW::Display displays[2] = {EDW::Display::CreateSimulated(edid, displayId, 2000), EDW::Display::CreateSimulated(edid, displayId, 2000)};
+	EDW::DisplayData newEdids[2] = {edid, edid};
+	EDW::DisplayData newDisplayId = displayId;
+
+	for (int index = 0; index < 2; ++index)
+	{
+		newEdids[index].SetByte(16, static_cast<unsigned char>(0x10 + index));
+		newEdids[index].SetByte(128 + 64, static_cast<unsigned char>(0x20 + index));
+		newEdids[index].FixEdidChecksums();
+	}
+
+	newDisplayId.SetByte(32, 0x5A);
+	newDisplayId.FixDisplayIdChecksums();
+
+	EDW::BusStatistics oldStatistics;
+	displays[0].GetBusStatistics(oldStatistics);
+
+	EDW::Provisioner provisioner;
+	provisioner.Add(displays[0], newEdids[0]);
+	provisioner.Add(displays[0], newDisplayId, EDW::ProvisionTarget::DisplayId);
+	provisioner.Add(displays[1], newEdids[1]);
+	EDW::Provisioner copy = provisioner;
+
+	if (!provisioner.Run() || provisioner.GetBusCount() != 2)
+		return false;
+
+	EDW::ProvisionJob copyJob;
+	EDW::DisplayData copyData;
+
+	if (!copy.GetJob(0, copyJob) || !copyJob.Output.GetEdid(copyData) || copyData != edid)
+		return false;
+
+	for (int index = 0; index < provisioner.GetCount(); ++index)
+	{
+		EDW::ProvisionResult result;
+
+		if (!provisioner.GetResult(index, result) || result.Status != EDW::ProvisionStatus::Written)
+			return false;
+	}
+
+	EDW::ProvisionJob jobs[3];
+	EDW::DisplayData displayData[3];
+
+	for (int index = 0; index < 3; ++index)
+		provisioner.GetJob(index, jobs[index]);
+
+	jobs[0].Output.GetEdid(displayData[0]);
+	jobs[1].Output.GetDisplayId(displayData[1]);
+	jobs[2].Output.GetEdid(displayData[2]);
+
+	if (displayData[0] != newEdids[0] || displayData[1] != newDisplayId || displayData[2] != newEdids[1])
+		return false;
+
+	EDW::BusStatistics newStatistics;
+	displays[0].GetBusStatistics(newStatistics);
+
+	if (newStatistics.Transfers != oldStatistics.Transfers)
+		return false;
+
+	if (!displays[0].ReadEdid(displayData[0]) || !displays[0].ReadDisplayId(displayData[1]) || !displays[1].ReadEdid(displayData[2]))
+		return false;
+
+	return displayData[0] == newEdids[0] && displayData[1] == newDisplayId && displayData[2] == newEdids[1];
+}
+
+// Variables ///////////////////////////////////////////////////////////////
+
+static const struct
+{
+	const char *Name;
+	bool (*Function)();
+}
+Tests[] =
+{
+	{"SetRange", TestSetRange},
+	{"Kernels", TestKernels},
+	{"HexDecode", TestHexDecode},
+	{"HexDecodeRows", TestHexDecodeRows},
+	{"LoadFormats", TestLoadFormats},
+	{"ReadSegment", TestReadSegment},
+	{"ReadRange", TestReadRange},
+	{"Transfer", TestTransfer},
+	{"NegotiateBusSpeed", TestNegotiateBusSpeed},
+	{"StepDownBusSpeed", TestStepDownBusSpeed},
+	{"RetryPolicy", TestRetryPolicy},
+	{"AckPolling", TestAckPolling},
+	{"WritePlan", TestWritePlan},
+	{"Journal", TestJournal},
+	{"WriteProtected", TestWriteProtected},
+	{"VerifyChecksums", TestVerifyChecksums},
+	{"WriteSegment", TestWriteSegment},
+	{"SegmentWire", TestSegmentWire},
+	{"SegmentReset", TestSegmentReset},
+	{"StableInvalidData", TestStableInvalidData},
+	{"Provisioner", TestProvisioner}
+};
+
+// Main ////////////////////////////////////////////////////////////////////
+
+int main()
+{
+	int failures = 0;
+
+	for (const auto &test : Tests)
+	{
+		bool success = test.Function();
+		std::printf("%s %s\n", success ? "PASS" : "FAIL", test.Name);
+
+		if (!success)
+			++failures;
+	}
+
+	return failures == 0 ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////